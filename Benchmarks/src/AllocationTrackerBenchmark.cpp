@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Allocations per second of AllocationTracker against the single map it replaced, at 1, 4 and 16 threads
+ */
+
+#include "Benchmark.hpp"
+
+#include <Core/Allocator.hpp>
+#include <Core/AllocationTracker.hpp>
+
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    constexpr uint32_t OperationsPerThread = 200000;
+    /** Allocations each thread keeps alive, so lookups run against a populated table. */
+    constexpr uint32_t LiveWindow = 64;
+    constexpr uint32_t Repeats = 3;
+    constexpr uint32_t ThreadCounts[] = {1, 4, 16};
+
+    struct Payload {
+        uint64_t Data[4];
+    };
+
+    /**
+     * The tracking Allocator did before AllocationTracker: one map and one byte counter. It had no lock at all, a
+     * mutex is the least it needs before several threads can use it.
+     */
+    struct MapTracker {
+        std::unordered_map<void*, size_t> Allocations;
+        size_t AllocatedSize{};
+        std::mutex Mutex;
+
+        void Track(void* instance, size_t size)
+        {
+            Allocations[instance] = size;
+            AllocatedSize += size;
+        }
+
+        void Untrack(void* instance)
+        {
+            auto found = Allocations.find(instance);
+            if (Allocations.end() == found) { return; }
+            AllocatedSize -= found->second;
+            Allocations.erase(found);
+        }
+    };
+
+    MapTracker s_MapTracker;
+
+    template <typename Allocate, typename Free>
+    void Churn(Allocate&& allocate, Free&& free)
+    {
+        Payload* live[LiveWindow]{};
+        for (uint32_t operation = 0; operation < OperationsPerThread; operation++)
+        {
+            auto& slot = live[operation % LiveWindow];
+            if (slot) { free(slot); }
+            slot = allocate();
+        }
+        for (auto* payload: live) { free(payload); }
+    }
+
+    void ChurnUnguardedMap()
+    {
+        Churn(
+                [] {
+                    auto* payload = new Payload{};
+                    s_MapTracker.Track(payload, sizeof(Payload));
+                    return payload;
+                },
+                [](Payload* payload) {
+                    s_MapTracker.Untrack(payload);
+                    delete payload;
+                });
+    }
+
+    void ChurnMap()
+    {
+        Churn(
+                [] {
+                    auto* payload = new Payload{};
+                    std::lock_guard lock(s_MapTracker.Mutex);
+                    s_MapTracker.Track(payload, sizeof(Payload));
+                    return payload;
+                },
+                [](Payload* payload) {
+                    {
+                        std::lock_guard lock(s_MapTracker.Mutex);
+                        s_MapTracker.Untrack(payload);
+                    }
+                    delete payload;
+                });
+    }
+
+    void ChurnTracker()
+    {
+        Churn(
+                [] {
+                    auto* payload = new Payload{};
+                    Engine::AllocationTracker::Track(payload, sizeof(Payload));
+                    return payload;
+                },
+                [](Payload* payload) {
+                    Engine::AllocationTracker::Untrack(payload);
+                    delete payload;
+                });
+    }
+
+    void ChurnAllocator()
+    {
+        Churn([] { return Engine::Allocator::Allocate<Payload>(); },
+              [](Payload* payload) { Engine::Allocator::Deallocate(payload); });
+    }
+
+    /** Millions of allocate and free pairs per second. */
+    template <typename Body>
+    double GetRate(uint32_t threadCount, Body&& body)
+    {
+        auto seconds = Benchmark::MeasureBest(Repeats, [&] {
+            Benchmark::RunThreads(threadCount, [&](uint32_t) { body(); });
+        });
+        return static_cast<double>(threadCount) * OperationsPerThread / seconds / 1e6;
+    }
+}// namespace
+
+int main()
+{
+    printf("%u allocate/free pairs of %zuB per thread, %u live per thread, M pairs/s, best of %u\n",
+           OperationsPerThread, sizeof(Payload), LiveWindow, Repeats);
+    printf("unguarded map (the old code, single thread only): %8.2f\n", GetRate(1, ChurnUnguardedMap));
+
+    printf("%8s %12s %18s %12s\n", "threads", "map+mutex", "AllocationTracker", "Allocator");
+    for (auto threadCount: ThreadCounts)
+    {
+        printf("%8u %12.2f %18.2f %12.2f\n", threadCount, GetRate(threadCount, ChurnMap),
+               GetRate(threadCount, ChurnTracker), GetRate(threadCount, ChurnAllocator));
+    }
+    return 0;
+}
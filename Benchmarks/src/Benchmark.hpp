@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Timing helpers shared by the benchmark executables
+ */
+
+#include <Core/Clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+    inline volatile uint64_t s_Sink;
+
+    /** Keeps a result alive so the measured work is not optimized away. */
+    template <typename T>
+    void Consume(T value)
+    {
+        if constexpr (std::is_pointer_v<T>) { s_Sink = s_Sink + reinterpret_cast<uintptr_t>(value); }
+        else { s_Sink = s_Sink + static_cast<uint64_t>(value); }
+    }
+
+    /** Wall seconds of one call of body. */
+    template <typename Body>
+    double Measure(Body&& body)
+    {
+        auto start = Engine::Clock::Now();
+        body();
+        return Engine::Clock::ToSeconds(Engine::Clock::Now() - start);
+    }
+
+    /** Fastest of repeats runs, the one least disturbed by the rest of the system. */
+    template <typename Body>
+    double MeasureBest(uint32_t repeats, Body&& body)
+    {
+        double best = Measure(body);
+        for (uint32_t repeat = 1; repeat < repeats; repeat++) { best = std::min(best, Measure(body)); }
+        return best;
+    }
+
+    /**
+     * Runs body(threadIndex) on threadCount threads that are released together, returns the wall seconds until the
+     * last one finishes. Thread creation is not part of the measurement.
+     */
+    template <typename Body>
+    double RunThreads(uint32_t threadCount, Body&& body)
+    {
+        std::atomic<uint32_t> ready{};
+        std::atomic<bool> start{};
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (uint32_t index = 0; index < threadCount; index++)
+        {
+            threads.emplace_back([&, index] {
+                ready.fetch_add(1, std::memory_order_release);
+                while (!start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+                body(index);
+            });
+        }
+
+        while (ready.load(std::memory_order_acquire) != threadCount) { std::this_thread::yield(); }
+        return Measure([&] {
+            start.store(true, std::memory_order_release);
+            for (auto& thread: threads) { thread.join(); }
+        });
+    }
+}// namespace Benchmark
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Hash throughput in GB/s for short inputs and for each long input path, Scalar, SSE2 and AVX2
+ */
+
+#include "Benchmark.hpp"
+
+#include <Core/Hash.hpp>
+
+#include <cstdio>
+#include <vector>
+
+using Engine::Hash;
+
+namespace
+{
+    /** Bytes hashed per measurement, whatever the input size. */
+    constexpr size_t BytesPerRun = 256ull << 20;
+    constexpr uint32_t Repeats = 5;
+    constexpr size_t ShortSizes[] = {8, 16, 32, 64, 128, 256, 512, 1000};
+    constexpr size_t LongSizes[] = {1024, 4096, 64 << 10, 1 << 20};
+    constexpr Hash::LongPath LongPaths[] = {Hash::LongPath::Scalar, Hash::LongPath::SSE2, Hash::LongPath::AVX2};
+
+    double GetGigabytesPerSecond(const std::vector<uint8_t>& data, size_t size)
+    {
+        auto iterations = BytesPerRun / size;
+        auto seconds = Benchmark::MeasureBest(Repeats, [&] {
+            // A different seed each time, so no call can be folded into the previous one.
+            for (size_t iteration = 0; iteration < iterations; iteration++)
+            {
+                Benchmark::Consume(Hash::Compute(data.data(), size, iteration));
+            }
+        });
+        return static_cast<double>(iterations * size) / seconds / 1e9;
+    }
+
+    /** Every path must give the same value, a faster path that does not is a bug. */
+    bool CheckPathsAgree(const std::vector<uint8_t>& data)
+    {
+        bool agree = true;
+        for (size_t size = Hash::LongInputSize; size <= 3 * Hash::LongInputSize + 1; size += 63)
+        {
+            Hash::SetLongPath(Hash::LongPath::Scalar);
+            auto expected = Hash::Compute(data.data(), size, size);
+            for (auto path: LongPaths)
+            {
+                if (!Hash::SetLongPath(path)) { continue; }
+                if (Hash::Compute(data.data(), size, size) == expected) { continue; }
+                printf("%s differs from Scalar at %zu bytes\n", Hash::GetLongPathName(path), size);
+                agree = false;
+            }
+        }
+        return agree;
+    }
+}// namespace
+
+int main()
+{
+    std::vector<uint8_t> data(LongSizes[std::size(LongSizes) - 1]);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (auto& byte: data)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<uint8_t>(state >> 56);
+    }
+
+    auto defaultPath = Hash::GetLongPath();
+    if (!CheckPathsAgree(data)) { return 1; }
+
+    printf("GB/s, best of %u runs of %zu MiB, default long path %s\n", Repeats, BytesPerRun >> 20,
+           Hash::GetLongPathName(defaultPath));
+
+    printf("%10s %10s\n", "bytes", "short");
+    for (auto size: ShortSizes) { printf("%10zu %10.2f\n", size, GetGigabytesPerSecond(data, size)); }
+
+    printf("%10s", "bytes");
+    for (auto path: LongPaths) { printf(" %10s", Hash::GetLongPathName(path)); }
+    printf("\n");
+    for (auto size: LongSizes)
+    {
+        printf("%10zu", size);
+        for (auto path: LongPaths)
+        {
+            if (Hash::SetLongPath(path)) { printf(" %10.2f", GetGigabytesPerSecond(data, size)); }
+            else { printf(" %10s", "n/a"); }
+        }
+        printf("\n");
+    }
+
+    Hash::SetLongPath(defaultPath);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Ref copy, move and create/destroy with both counting policies against std::shared_ptr and raw pointers
+ */
+
+#include "Benchmark.hpp"
+
+#include <Core/Ref.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    constexpr uint32_t Iterations = 10000000;
+    constexpr uint32_t CreateIterations = 1000000;
+    constexpr uint32_t Repeats = 5;
+
+    struct AtomicObject: public RefCounted {
+        uint64_t Value{};
+    };
+
+    struct LocalObject: public LocalRefCounted {
+        uint64_t Value{};
+    };
+
+    struct PlainObject {
+        uint64_t Value{};
+    };
+
+    template <typename T, typename Policy>
+    const T* GetPointer(const Ref<T, Policy>& reference)
+    {
+        return reference.Raw();
+    }
+
+    template <typename T>
+    const T* GetPointer(const std::shared_ptr<T>& reference)
+    {
+        return reference.get();
+    }
+
+    template <typename T>
+    const T* GetPointer(const std::unique_ptr<T>& reference)
+    {
+        return reference.get();
+    }
+
+    template <typename T>
+    const T* GetPointer(T* reference)
+    {
+        return reference;
+    }
+
+    /** Nanoseconds per iteration of body. */
+    template <typename Body>
+    double GetNanoseconds(uint32_t iterations, Body&& body)
+    {
+        return Benchmark::MeasureBest(Repeats, [&] {
+                   for (uint32_t iteration = 0; iteration < iterations; iteration++) { body(); }
+               }) *
+               1e9 / iterations;
+    }
+
+    /** Copy construction from a live reference followed by the destruction of the copy. */
+    template <typename Reference>
+    double CopyAndDestroy(const Reference& source)
+    {
+        return GetNanoseconds(Iterations, [&] {
+            Reference copy = source;
+            Benchmark::Consume(GetPointer(copy));
+        });
+    }
+
+    /** Two moves, one there and one back. */
+    template <typename Reference>
+    double Move(Reference& source)
+    {
+        return GetNanoseconds(Iterations, [&] {
+            Reference moved = std::move(source);
+            source = std::move(moved);
+            Benchmark::Consume(GetPointer(source));
+        });
+    }
+
+    template <typename Create>
+    double CreateAndDestroy(Create&& create)
+    {
+        return GetNanoseconds(CreateIterations, [&] {
+            auto reference = create();
+            Benchmark::Consume(GetPointer(reference));
+        });
+    }
+
+    void PrintRow(const char* name, double copy, double move, double create)
+    {
+        printf("%-24s %12.2f %12.2f %16.2f\n", name, copy, move, create);
+    }
+}// namespace
+
+int main()
+{
+    // The engine always runs other threads, without one std::shared_ptr would skip its atomic counting.
+    std::thread([] {}).join();
+
+    auto atomicRef = Ref<AtomicObject>::Create();
+    auto localRef = Ref<LocalObject>::Create();
+    auto sharedPtr = std::make_shared<PlainObject>();
+    auto rawPointer = new PlainObject();
+
+    printf("ns per operation, best of %u, copy and move over %u iterations, create over %u\n", Repeats, Iterations,
+           CreateIterations);
+    printf("%-24s %12s %12s %16s\n", "", "copy+destroy", "move", "create+destroy");
+    PrintRow("Ref (AtomicRefPolicy)", CopyAndDestroy(atomicRef), Move(atomicRef),
+             CreateAndDestroy([] { return Ref<AtomicObject>::Create(); }));
+    PrintRow("Ref (LocalRefPolicy)", CopyAndDestroy(localRef), Move(localRef),
+             CreateAndDestroy([] { return Ref<LocalObject>::Create(); }));
+    PrintRow("std::shared_ptr", CopyAndDestroy(sharedPtr), Move(sharedPtr),
+             CreateAndDestroy([] { return std::make_shared<PlainObject>(); }));
+    PrintRow("raw pointer", CopyAndDestroy(rawPointer), Move(rawPointer), CreateAndDestroy([] {
+                 // Owned by the unique_ptr, so the raw row pays for new and delete like the others.
+                 return std::unique_ptr<PlainObject>(new PlainObject());
+             }));
+
+    delete rawPointer;
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Multi-threaded Ref copy and destroy, on one shared object and on one object per thread
+ */
+
+#include "Benchmark.hpp"
+
+#include <Core/Ref.hpp>
+
+#include <cstdio>
+#include <memory>
+
+namespace
+{
+    constexpr uint32_t CopiesPerThread = 1000000;
+    constexpr uint32_t Repeats = 3;
+    constexpr uint32_t ThreadCounts[] = {1, 2, 4, 8, 16};
+    constexpr uint32_t MaxThreads = 16;
+
+    struct SharedObject: public RefCounted {
+        uint64_t Value{};
+    };
+
+    const SharedObject* GetPointer(const Ref<SharedObject>& reference) { return reference.Raw(); }
+
+    const SharedObject* GetPointer(const std::shared_ptr<SharedObject>& reference) { return reference.get(); }
+
+    /**
+     * Millions of copy and destroy pairs per second over all threads. With shared set every thread copies the first
+     * source, so all of them contend on one counter, otherwise each thread has its own object.
+     */
+    template <typename Reference>
+    double GetRate(uint32_t threadCount, const Reference* sources, bool shared)
+    {
+        auto seconds = Benchmark::MeasureBest(Repeats, [&] {
+            Benchmark::RunThreads(threadCount, [&](uint32_t thread) {
+                const auto& source = sources[shared ? 0 : thread];
+                for (uint32_t copy = 0; copy < CopiesPerThread; copy++)
+                {
+                    Reference reference = source;
+                    Benchmark::Consume(GetPointer(reference));
+                }
+            });
+        });
+        return static_cast<double>(threadCount) * CopiesPerThread / seconds / 1e6;
+    }
+}// namespace
+
+int main()
+{
+    Ref<SharedObject> refs[MaxThreads];
+    Ref<SharedObject> weakRefs[MaxThreads];
+    WeakRef<SharedObject> weak[MaxThreads];
+    std::shared_ptr<SharedObject> sharedPtrs[MaxThreads];
+    for (uint32_t index = 0; index < MaxThreads; index++)
+    {
+        refs[index] = Ref<SharedObject>::Create();
+        // A weak reference moves the count into a control block, strong counts then take fetch_add instead of CAS.
+        weakRefs[index] = Ref<SharedObject>::Create();
+        weak[index] = WeakRef<SharedObject>(weakRefs[index]);
+        sharedPtrs[index] = std::make_shared<SharedObject>();
+    }
+
+    printf("%u copy/destroy pairs per thread, M pairs/s over all threads, best of %u\n", CopiesPerThread, Repeats);
+    printf("%8s %12s %12s %14s %14s %14s %14s\n", "threads", "Ref shared", "Ref own", "Ref+weak shr", "Ref+weak own",
+           "shared_ptr shr", "shared_ptr own");
+    for (auto threadCount: ThreadCounts)
+    {
+        printf("%8u %12.2f %12.2f %14.2f %14.2f %14.2f %14.2f\n", threadCount, GetRate(threadCount, refs, true),
+               GetRate(threadCount, refs, false), GetRate(threadCount, weakRefs, true),
+               GetRate(threadCount, weakRefs, false), GetRate(threadCount, sharedPtrs, true),
+               GetRate(threadCount, sharedPtrs, false));
+    }
+    return 0;
+}
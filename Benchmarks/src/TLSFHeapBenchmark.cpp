@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * TLSFHeap allocate/free rate against malloc, for small sizes and for requests larger than a region
+ */
+
+#include "Benchmark.hpp"
+
+#include <Core/TLSFHeap.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+using Engine::TLSFHeap;
+
+namespace
+{
+    constexpr uint32_t SmallOperations = 1000000;
+    constexpr uint32_t LargeOperations = 2000;
+    constexpr uint32_t LiveWindow = 64;
+    constexpr uint32_t Repeats = 3;
+    constexpr size_t RegionSize = 1 << 20;
+    /** Bigger than a region and off a bin boundary, each one needs a region sized for it. */
+    constexpr size_t LargeSize = (3 << 20) + 16;
+
+    size_t GetSmallSize(uint32_t operation) { return 16 + (operation * 2654435761u >> 24); }
+
+    /** Millions of allocate and free pairs per second, with LiveWindow allocations kept alive. */
+    template <typename Allocate, typename Free>
+    double GetRate(uint32_t operations, Allocate&& allocate, Free&& free)
+    {
+        auto seconds = Benchmark::MeasureBest(Repeats, [&] {
+            void* live[LiveWindow]{};
+            for (uint32_t operation = 0; operation < operations; operation++)
+            {
+                auto& slot = live[operation % LiveWindow];
+                free(slot);
+                slot = allocate(operation);
+                Benchmark::Consume(slot);
+            }
+            for (auto* memory: live) { free(memory); }
+        });
+        return operations / seconds / 1e6;
+    }
+}// namespace
+
+int main()
+{
+    TLSFHeap heap;
+    heap.Init(RegionSize);
+    auto heapFree = [&](void* memory) { heap.Deallocate(memory); };
+    auto mallocFree = [](void* memory) { free(memory); };
+
+    printf("M allocate/free pairs/s, %u live, best of %u, %zuB regions\n", LiveWindow, Repeats, RegionSize);
+    printf("%-24s %12s %12s\n", "", "TLSFHeap", "malloc");
+    auto small = GetRate(SmallOperations, [&](uint32_t op) { return heap.Allocate(GetSmallSize(op)); }, heapFree);
+    printf("%-24s %12.2f %12.2f\n", "16-271B", small,
+           GetRate(SmallOperations, [](uint32_t op) { return malloc(GetSmallSize(op)); }, mallocFree));
+
+    // Every call failing to reuse the regions of the previous ones would reserve a new region each time.
+    auto regionsBefore = heap.GetStats().RegionCount;
+    auto large = GetRate(LargeOperations, [&](uint32_t) { return heap.Allocate(LargeSize); }, heapFree);
+    auto stats = heap.GetStats();
+    printf("%-24s %12.2f %12.2f\n", "3MiB+16B", large,
+           GetRate(LargeOperations, [](uint32_t) { return malloc(LargeSize); }, mallocFree));
+    printf("regions %zu after small, %zu after large, %zu MiB reserved, high water mark %zu MiB\n", regionsBefore,
+           stats.RegionCount, stats.ReservedBytes >> 20, stats.HighWaterMark >> 20);
+
+    if (stats.RegionCount > regionsBefore + LiveWindow)
+    {
+        printf("Large allocations do not reuse their regions\n");
+        return 1;
+    }
+    return 0;
+}
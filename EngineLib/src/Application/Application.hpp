@@ -11,6 +11,12 @@
 
 #include <filesystem>
 #include <types.hpp>
+#include <Core/Allocator.hpp>
+#include <Core/AllocationMonitor.hpp>
+#include <Core/FrameArena.hpp>
+#include <Core/FrameStats.hpp>
+#include <Core/Log.hpp>
+#include <Core/Profiler.hpp>
 namespace Engine
 {
     struct ApplicationSpec {
@@ -18,6 +24,13 @@ namespace Engine
         std::filesystem::path WorkingDirectory;
         u32 StartupWidth;
         u32 StartupHeight;
+        size_t FrameArenaSize = FrameArena::DefaultCapacity;
+        u32 FramesInFlight = 2;
+        AllocatorSpec MemorySpec{};
+        AllocationCheckSpec AllocationCheck{};
+        LoggerSpec Log{};
+        ProfilerSpec Profile{};
+        FrameStatsSpec Stats{};
     };
 
     class Application
@@ -38,12 +51,14 @@ namespace Engine
 
         static Application* Get();
         static ApplicationSpec& GetSpec();
+        static FrameArena& GetFrameArena();
 
     private:
         static Application* s_Application;
     private:
         bool m_StoppedFlag{};
         ApplicationSpec m_ApplicationSpec{};
+        FrameArena m_FrameArena{};
     };
 
 }// namespace Engine
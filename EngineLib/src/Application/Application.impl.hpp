@@ -10,6 +10,7 @@
 
 #include <Layer/LayerStack.hpp>
 #include <Core/Log.hpp>
+#include <Core/Clock.hpp>
 #include <Core/Allocator.hpp>
 #include <Renderer/Renderer.hpp>
 #include "Application.hpp"
@@ -23,18 +24,49 @@ namespace Engine
 
     void Application::Run()
     {
-        LayerStack::InitLayers();
+        {
+            MemoryTagScope memoryTag(MemoryTag::Layer);
+            LayerStack::InitLayers();
+        }
 
+        auto& frameArena = Application::GetFrameArena();
+        const auto runStart = Clock::Now();
+        auto previousFrameStart = runStart;
         while (!Window::ShouldClose())
         {
-            auto& layersStatus = *LayerStack::GetLayers().value;
-            for (auto& layer: layersStatus)
+            const auto frameStart = Clock::Now();
+            UpdateContext context{frameArena, frameArena.GetFrameNumber(), frameStart,
+                                  Timestep(Clock::ToSeconds(frameStart - previousFrameStart)),
+                                  Clock::ToSeconds(frameStart - runStart)};
+            previousFrameStart = frameStart;
+
+            PROFILE_FRAME(context.FrameNumber);
+            PROFILE_SCOPE("Frame");
+            FrameStats::BeginFrame(context.FrameNumber, frameStart);
+            AllocationMonitor::BeginFrame(context.FrameNumber);
+
             {
-                layer->OnUpdate();
+                PROFILE_SCOPE("Layers");
+                MemoryTagScope memoryTag(MemoryTag::Layer);
+                auto& layersStatus = *LayerStack::GetLayers().value;
+                for (auto& layer: layersStatus)
+                {
+                    // Interned text outlives the layer, the trace is written after layers are destroyed.
+                    PROFILE_SCOPE(layer->GetId().GetString());
+                    FrameStatsLayerScope frameStatsScope(layer->GetId());
+                    AllocationMonitorScope allocationScope(layer->GetName());
+                    layer->OnUpdate(context);
+                }
             }
           
-            Window::PollEvents();
+            {
+                PROFILE_SCOPE("PollEvents");
+                Window::PollEvents();
+            }
 
+            frameArena.NextFrame();
+            AllocationMonitor::EndFrame();
+            FrameStats::EndFrame();
         }
     }
 
@@ -42,8 +74,18 @@ namespace Engine
     {
         if (nullptr == Application::s_Application)
         {
+            Logger::Create(applicationSpec.Log);
+            Profiler::Init(applicationSpec.Profile);
+            PROFILE_THREAD("Main");
+            PROFILE_FUNCTION();
+            Allocator::Init(applicationSpec.MemorySpec);
+            AllocationMonitor::Init(applicationSpec.AllocationCheck);
+            FrameStats::Init(applicationSpec.Stats);
+
             Application::s_Application = Allocator::Allocate<Application>();
             Application::s_Application->m_ApplicationSpec = applicationSpec;
+            Application::s_Application->m_FrameArena.Init(applicationSpec.FrameArenaSize,
+                                                          applicationSpec.FramesInFlight);
 
             LOG_INFO("Application initialized!\n");
             RendererSpec rendererSpec;
@@ -51,7 +93,10 @@ namespace Engine
             rendererSpec.WorkingDirectory = Application::GetSpec().WorkingDirectory;
             rendererSpec.width = Application::GetSpec().StartupWidth;
             rendererSpec.height = Application::GetSpec().StartupHeight;
-            Renderer<>::Create(rendererSpec);
+            {
+                MemoryTagScope memoryTag(MemoryTag::Renderer);
+                Renderer<>::Create(rendererSpec);
+            }
 
             LayerStack::Init();
         }
@@ -68,6 +113,12 @@ namespace Engine
 
             Allocator::Deallocate(Application::s_Application);
             LOG_INFO("Application destroyed!\n");
+
+            Allocator::LogStats();
+            Allocator::ReportLeaks();
+            FrameStats::Shutdown();
+            Profiler::Shutdown();
+            Logger::Shutdown();
         }
     }
 
@@ -75,10 +126,16 @@ namespace Engine
 
     ApplicationSpec& Application::GetSpec() { return Application::Get()->m_ApplicationSpec; }
 
+    FrameArena& Application::GetFrameArena() { return Application::Get()->m_FrameArena; }
+
     template <typename T>
     void Application::AddLayer()
     {
         if (!std::derived_from<T, Layer>) { LOG_INFO("Layer type does not have Layer as a Base type!\n"); }
-        else { LayerStack::AddLayer<T>(); }
+        else
+        {
+            MemoryTagScope memoryTag(MemoryTag::Layer);
+            LayerStack::AddLayer<T>();
+        }
     }
 }// namespace Engine
\ No newline at end of file
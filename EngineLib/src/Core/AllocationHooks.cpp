@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Global operator new/delete replacements that count system heap traffic per thread.
+ * Only compiled with ENGINE_ENABLE_ALLOCATION_HOOKS, see AllocationMonitor.
+ */
+
+#ifdef ENGINE_ENABLE_ALLOCATION_HOOKS
+
+#include <Core/AllocationTracker.hpp>
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void* AllocateSystem(size_t size)
+    {
+        Engine::AllocationTracker::CountSystemAllocation(size);
+        if (auto memory = std::malloc(size ? size : 1)) { return memory; }
+        throw std::bad_alloc();
+    }
+
+    void* AllocateSystemAligned(size_t size, std::align_val_t alignment)
+    {
+        Engine::AllocationTracker::CountSystemAllocation(size);
+        auto align = static_cast<size_t>(alignment);
+#ifdef _WIN32
+        auto memory = _aligned_malloc(size ? size : 1, align);
+#else
+        auto memory = std::aligned_alloc(align, ((size ? size : 1) + align - 1) & ~(align - 1));
+#endif
+        if (memory) { return memory; }
+        throw std::bad_alloc();
+    }
+
+    void FreeSystem(void* memory) noexcept
+    {
+        if (nullptr == memory) { return; }
+        Engine::AllocationTracker::CountSystemFree();
+        std::free(memory);
+    }
+
+    void FreeSystemAligned(void* memory) noexcept
+    {
+        if (nullptr == memory) { return; }
+        Engine::AllocationTracker::CountSystemFree();
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+}// namespace
+
+void* operator new(size_t size) { return AllocateSystem(size); }
+
+void* operator new[](size_t size) { return AllocateSystem(size); }
+
+void* operator new(size_t size, std::align_val_t alignment) { return AllocateSystemAligned(size, alignment); }
+
+void* operator new[](size_t size, std::align_val_t alignment) { return AllocateSystemAligned(size, alignment); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return AllocateSystem(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return AllocateSystem(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* memory) noexcept { FreeSystem(memory); }
+
+void operator delete[](void* memory) noexcept { FreeSystem(memory); }
+
+void operator delete(void* memory, size_t) noexcept { FreeSystem(memory); }
+
+void operator delete[](void* memory, size_t) noexcept { FreeSystem(memory); }
+
+void operator delete(void* memory, std::align_val_t) noexcept { FreeSystemAligned(memory); }
+
+void operator delete[](void* memory, std::align_val_t) noexcept { FreeSystemAligned(memory); }
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { FreeSystemAligned(memory); }
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { FreeSystemAligned(memory); }
+
+#endif
@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * AllocationMonitor class implementation
+ */
+
+#include "AllocationMonitor.hpp"
+#include <Core/Log.hpp>
+
+#include <cassert>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr size_t MaxScopeDepth = 8;
+
+        struct ScopeStart {
+            std::string_view Name;
+            ThreadAllocationStats Stats;
+        };
+
+        AllocationCheckSpec s_Spec{};
+        FrameAllocationStats s_CurrentFrame{};
+        FrameAllocationStats s_LastFrame{};
+
+        std::array<ThreadAllocationStats, FrameAllocationStats::MaxThreads> s_FrameStartThreads{};
+        size_t s_FrameStartThreadCount{};
+
+        std::array<ScopeStart, MaxScopeDepth> s_ScopeStack{};
+        size_t s_ScopeDepth{};
+
+        AllocationCounts Difference(const ThreadAllocationStats& from, const ThreadAllocationStats& to)
+        {
+            AllocationCounts counts{};
+            counts.Allocations = to.AllocationCount - from.AllocationCount;
+            counts.Frees = to.FreeCount - from.FreeCount;
+            counts.Bytes = to.AllocatedBytes - from.AllocatedBytes;
+            counts.SystemAllocations = to.SystemAllocationCount - from.SystemAllocationCount;
+            counts.SystemFrees = to.SystemFreeCount - from.SystemFreeCount;
+            return counts;
+        }
+
+        void Accumulate(AllocationCounts& total, const AllocationCounts& counts)
+        {
+            total.Allocations += counts.Allocations;
+            total.Frees += counts.Frees;
+            total.Bytes += counts.Bytes;
+            total.SystemAllocations += counts.SystemAllocations;
+            total.SystemFrees += counts.SystemFrees;
+        }
+    }// namespace
+
+    void AllocationMonitor::Init(AllocationCheckSpec spec) { s_Spec = spec; }
+
+    void AllocationMonitor::BeginFrame(uint64_t frameNumber)
+    {
+        s_CurrentFrame.FrameNumber = frameNumber;
+        s_CurrentFrame.Total = {};
+        s_CurrentFrame.ScopeCount = 0;
+        s_CurrentFrame.ThreadCount = 0;
+        s_ScopeDepth = 0;
+
+        s_FrameStartThreadCount = AllocationTracker::GetThreadStats(s_FrameStartThreads.data(), s_FrameStartThreads.size());
+    }
+
+    void AllocationMonitor::EndFrame()
+    {
+        std::array<ThreadAllocationStats, FrameAllocationStats::MaxThreads> threads{};
+        auto threadCount = AllocationTracker::GetThreadStats(threads.data(), threads.size());
+
+        for (size_t index = 0; index < threadCount; index++)
+        {
+            // Threads that showed up during the frame start from zero.
+            ThreadAllocationStats start{};
+            start.ThreadIndex = threads[index].ThreadIndex;
+            for (size_t startIndex = 0; startIndex < s_FrameStartThreadCount; startIndex++)
+            {
+                if (s_FrameStartThreads[startIndex].ThreadIndex == threads[index].ThreadIndex)
+                {
+                    start = s_FrameStartThreads[startIndex];
+                    break;
+                }
+            }
+
+            auto counts = Difference(start, threads[index]);
+            if (!counts.HasAllocations() && 0 == counts.Frees && 0 == counts.SystemFrees) { continue; }
+
+            auto& thread = s_CurrentFrame.Threads[s_CurrentFrame.ThreadCount++];
+            thread.ThreadIndex = threads[index].ThreadIndex;
+            thread.Counts = counts;
+            Accumulate(s_CurrentFrame.Total, counts);
+        }
+
+        s_LastFrame = s_CurrentFrame;
+
+        if (AllocationCheckMode::Off != s_Spec.Mode && s_LastFrame.FrameNumber >= s_Spec.WarmupFrames &&
+            s_LastFrame.Total.HasAllocations())
+        {
+            Report(s_LastFrame);
+            assert(AllocationCheckMode::Assert != s_Spec.Mode && "Steady state frame allocated!");
+        }
+    }
+
+    void AllocationMonitor::BeginScope(std::string_view name)
+    {
+        if (s_ScopeDepth >= MaxScopeDepth) { return; }
+        s_ScopeStack[s_ScopeDepth++] = {name, AllocationTracker::GetCurrentThreadStats()};
+    }
+
+    void AllocationMonitor::EndScope()
+    {
+        if (0 == s_ScopeDepth) { return; }
+
+        auto& start = s_ScopeStack[--s_ScopeDepth];
+        auto counts = Difference(start.Stats, AllocationTracker::GetCurrentThreadStats());
+
+        for (size_t index = 0; index < s_CurrentFrame.ScopeCount; index++)
+        {
+            auto& scope = s_CurrentFrame.Scopes[index];
+            if (scope.Name == start.Name)
+            {
+                Accumulate(scope.Counts, counts);
+                return;
+            }
+        }
+
+        if (s_CurrentFrame.ScopeCount < FrameAllocationStats::MaxScopes)
+        {
+            s_CurrentFrame.Scopes[s_CurrentFrame.ScopeCount++] = {start.Name, counts};
+        }
+    }
+
+    const FrameAllocationStats& AllocationMonitor::GetLastFrame() { return s_LastFrame; }
+
+    AllocationCheckSpec AllocationMonitor::GetSpec() { return s_Spec; }
+
+    void AllocationMonitor::Report(const FrameAllocationStats& stats)
+    {
+        LOG_WARNING("Frame %llu allocated: %zu allocations (%zuB), %zu frees, %zu system allocations, %zu system "
+                    "frees\n",
+                    (unsigned long long) stats.FrameNumber, stats.Total.Allocations, stats.Total.Bytes,
+                    stats.Total.Frees, stats.Total.SystemAllocations, stats.Total.SystemFrees);
+
+        for (size_t index = 0; index < stats.ScopeCount; index++)
+        {
+            auto& scope = stats.Scopes[index];
+            if (!scope.Counts.HasAllocations()) { continue; }
+            LOG_WARNING("    %.*s: %zu allocations (%zuB), %zu system allocations\n", (int) scope.Name.size(),
+                        scope.Name.data(), scope.Counts.Allocations, scope.Counts.Bytes,
+                        scope.Counts.SystemAllocations);
+        }
+
+        for (size_t index = 0; index < stats.ThreadCount; index++)
+        {
+            auto& thread = stats.Threads[index];
+            if (!thread.Counts.HasAllocations()) { continue; }
+            LOG_WARNING("    Thread %u: %zu allocations (%zuB), %zu system allocations\n", thread.ThreadIndex,
+                        thread.Counts.Allocations, thread.Counts.Bytes, thread.Counts.SystemAllocations);
+        }
+    }
+}// namespace Engine
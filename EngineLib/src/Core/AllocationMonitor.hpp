@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * AllocationMonitor class definition
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <Core/AllocationTracker.hpp>
+
+namespace Engine
+{
+    enum class AllocationCheckMode
+    {
+        Off,
+        Log,
+        Assert
+    };
+
+    struct AllocationCheckSpec {
+        AllocationCheckMode Mode = AllocationCheckMode::Off;
+
+        /** Frames allowed to allocate while caches, arenas and pools warm up. */
+        uint64_t WarmupFrames = 120;
+    };
+
+    struct AllocationCounts {
+        size_t Allocations{};
+        size_t Frees{};
+        size_t Bytes{};
+        size_t SystemAllocations{};
+        size_t SystemFrees{};
+
+        bool HasAllocations() const { return Allocations > 0 || SystemAllocations > 0; }
+    };
+
+    struct ScopeAllocationCounts {
+        std::string_view Name;
+        AllocationCounts Counts;
+    };
+
+    struct ThreadAllocationCounts {
+        uint32_t ThreadIndex{};
+        AllocationCounts Counts;
+    };
+
+    struct FrameAllocationStats {
+        static constexpr size_t MaxScopes = 32;
+        static constexpr size_t MaxThreads = 64;
+
+        uint64_t FrameNumber{};
+        AllocationCounts Total;
+        std::array<ScopeAllocationCounts, MaxScopes> Scopes{};
+        size_t ScopeCount{};
+        std::array<ThreadAllocationCounts, MaxThreads> Threads{};
+        size_t ThreadCount{};
+    };
+
+    /**
+     * Counts allocations made during each frame of Application::Run, per thread and per layer update.
+     *
+     * The counts are differences of the per thread totals kept by AllocationTracker, so the monitor adds nothing
+     * to the allocation path and never allocates itself. Engine::Allocator calls are always seen; raw new/delete
+     * (std containers, strings) are only seen when built with ENGINE_ENABLE_ALLOCATION_HOOKS. Past the warm up,
+     * a frame that allocates is logged, or asserted on, depending on the mode.
+     */
+    class AllocationMonitor
+    {
+    public:
+        static void Init(AllocationCheckSpec spec);
+
+        static void BeginFrame(uint64_t frameNumber);
+
+        static void EndFrame();
+
+        static void BeginScope(std::string_view name);
+
+        static void EndScope();
+
+        static const FrameAllocationStats& GetLastFrame();
+
+        static AllocationCheckSpec GetSpec();
+
+    private:
+        static void Report(const FrameAllocationStats& stats);
+    };
+
+    class AllocationMonitorScope
+    {
+    public:
+        AllocationMonitorScope(std::string_view name) { AllocationMonitor::BeginScope(name); }
+
+        ~AllocationMonitorScope() { AllocationMonitor::EndScope(); }
+
+        AllocationMonitorScope(const AllocationMonitorScope&) = delete;
+        AllocationMonitorScope& operator=(const AllocationMonitorScope&) = delete;
+    };
+}// namespace Engine
@@ -0,0 +1,380 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * AllocationTracker class implementation
+ */
+
+#include "AllocationTracker.hpp"
+#include <Core/SpinLock.hpp>
+#include <Core/Log.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr size_t ShardCountBits = 6;
+        constexpr size_t ShardCount = size_t(1) << ShardCountBits;
+
+        struct alignas(64) AllocationShard {
+            SpinLock Lock;
+            std::unordered_map<void*, AllocationRecord> Allocations;
+        };
+
+        struct alignas(64) ThreadCounters {
+            std::atomic<size_t> AllocatedBytes{};
+            std::atomic<size_t> FreedBytes{};
+            std::atomic<size_t> AllocationCount{};
+            std::atomic<size_t> FreeCount{};
+            std::atomic<size_t> SystemAllocatedBytes{};
+            std::atomic<size_t> SystemAllocationCount{};
+            std::atomic<size_t> SystemFreeCount{};
+            std::atomic<bool> InUse{};
+            uint32_t Index{};
+            ThreadCounters* Next{};
+        };
+
+        AllocationShard* GetShards()
+        {
+            // Never destroyed, allocations may still be released from static destructors.
+            static AllocationShard* shards = new AllocationShard[ShardCount];
+            return shards;
+        }
+
+        AllocationShard& GetShard(const void* instance)
+        {
+            auto key = reinterpret_cast<uintptr_t>(instance) >> 4;
+            key *= 0x9E3779B97F4A7C15ull;
+            return GetShards()[(key >> (64 - ShardCountBits)) & (ShardCount - 1)];
+        }
+
+        std::atomic<ThreadCounters*> s_ThreadCountersHead{};
+        std::atomic<uint32_t> s_ThreadCountersCount{};
+
+        ThreadCounters* AcquireThreadCounters()
+        {
+            for (auto counters = s_ThreadCountersHead.load(std::memory_order_acquire); counters;
+                 counters = counters->Next)
+            {
+                bool expected = false;
+                if (!counters->InUse.load(std::memory_order_relaxed) &&
+                    counters->InUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    return counters;
+                }
+            }
+
+            // Taken from malloc, the slot may be created from inside a counted operator new.
+            auto counters = new (std::malloc(sizeof(ThreadCounters))) ThreadCounters();
+            counters->Index = s_ThreadCountersCount.fetch_add(1, std::memory_order_relaxed);
+            counters->InUse.store(true, std::memory_order_relaxed);
+            counters->Next = s_ThreadCountersHead.load(std::memory_order_relaxed);
+            while (!s_ThreadCountersHead.compare_exchange_weak(counters->Next, counters, std::memory_order_release,
+                                                               std::memory_order_relaxed))
+            {
+            }
+            return counters;
+        }
+
+        thread_local ThreadCounters* t_ThreadCounters{};
+        thread_local bool t_ThreadCountersReleased{};
+
+        // Totals stay in the list; the slot is only handed over to the next thread that starts allocating.
+        struct ThreadCountersRelease {
+            ~ThreadCountersRelease()
+            {
+                if (t_ThreadCounters) { t_ThreadCounters->InUse.store(false, std::memory_order_release); }
+                t_ThreadCounters = nullptr;
+                t_ThreadCountersReleased = true;
+            }
+        };
+
+        // Returns nullptr once the calling thread is shutting down, its late frees are then not counted.
+        ThreadCounters* GetThreadCounters()
+        {
+            if (nullptr == t_ThreadCounters && !t_ThreadCountersReleased)
+            {
+                t_ThreadCounters = AcquireThreadCounters();
+                thread_local ThreadCountersRelease release;
+                (void) release;
+            }
+            return t_ThreadCounters;
+        }
+
+        ThreadAllocationStats ToThreadStats(const ThreadCounters& counters)
+        {
+            ThreadAllocationStats stats{};
+            stats.ThreadIndex = counters.Index;
+            stats.AllocatedBytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+            stats.AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed);
+            stats.FreeCount = counters.FreeCount.load(std::memory_order_relaxed);
+            stats.SystemAllocatedBytes = counters.SystemAllocatedBytes.load(std::memory_order_relaxed);
+            stats.SystemAllocationCount = counters.SystemAllocationCount.load(std::memory_order_relaxed);
+            stats.SystemFreeCount = counters.SystemFreeCount.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        // Only the owning thread writes its counters, so a relaxed load/store pair is enough.
+        void Increment(std::atomic<size_t>& counter, size_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        struct alignas(64) TagCounters {
+            std::atomic<size_t> LiveBytes{};
+            std::atomic<size_t> PeakBytes{};
+            std::atomic<size_t> LiveAllocations{};
+            std::atomic<size_t> AllocationCount{};
+            std::atomic<size_t> SoftBudget{};
+            std::atomic<size_t> HardBudget{};
+            std::atomic<bool> SoftExceeded{};
+            std::atomic<bool> HardExceeded{};
+        };
+
+        TagCounters s_TagCounters[MemoryTagCount];
+
+        void DefaultBudgetCallback(MemoryTag tag, MemoryBudgetLevel level, size_t liveBytes, size_t budget)
+        {
+            if (MemoryBudgetLevel::Hard == level)
+            {
+                LOG_ERROR("Memory tag %s exceeded its hard budget: %zuB of %zuB\n", MemoryTagToString(tag), liveBytes,
+                          budget);
+            }
+            else
+            {
+                LOG_WARNING("Memory tag %s exceeded its soft budget: %zuB of %zuB\n", MemoryTagToString(tag),
+                            liveBytes, budget);
+            }
+        }
+
+        std::atomic<MemoryBudgetCallback> s_BudgetCallback{DefaultBudgetCallback};
+
+        std::atomic<bool> s_CaptureCallStacks{};
+
+        void CheckBudget(MemoryTag tag, MemoryBudgetLevel level, std::atomic<size_t>& budget,
+                         std::atomic<bool>& exceeded, size_t liveBytes)
+        {
+            // Report once per crossing, the flag is cleared when the tag drops back under the budget.
+            auto limit = budget.load(std::memory_order_relaxed);
+            if (0 == limit || liveBytes <= limit || exceeded.load(std::memory_order_relaxed)) { return; }
+            if (exceeded.exchange(true, std::memory_order_relaxed)) { return; }
+
+            auto callback = s_BudgetCallback.load(std::memory_order_acquire);
+            if (callback) { callback(tag, level, liveBytes, limit); }
+        }
+
+        void AddToTag(MemoryTag tag, size_t size)
+        {
+            auto& counters = s_TagCounters[static_cast<size_t>(tag)];
+            auto liveBytes = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+            counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+            auto peak = counters.PeakBytes.load(std::memory_order_relaxed);
+            while (liveBytes > peak &&
+                   !counters.PeakBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed))
+            {
+            }
+
+            CheckBudget(tag, MemoryBudgetLevel::Soft, counters.SoftBudget, counters.SoftExceeded, liveBytes);
+            CheckBudget(tag, MemoryBudgetLevel::Hard, counters.HardBudget, counters.HardExceeded, liveBytes);
+        }
+
+        void RemoveFromTag(MemoryTag tag, size_t size)
+        {
+            auto& counters = s_TagCounters[static_cast<size_t>(tag)];
+            auto liveBytes = counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed) - size;
+            counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+            if (counters.SoftExceeded.load(std::memory_order_relaxed) &&
+                liveBytes <= counters.SoftBudget.load(std::memory_order_relaxed))
+            {
+                counters.SoftExceeded.store(false, std::memory_order_relaxed);
+            }
+            if (counters.HardExceeded.load(std::memory_order_relaxed) &&
+                liveBytes <= counters.HardBudget.load(std::memory_order_relaxed))
+            {
+                counters.HardExceeded.store(false, std::memory_order_relaxed);
+            }
+        }
+    }// namespace
+
+    bool AllocationTracker::Track(void* instance, size_t size, AllocationSource source, MemoryTag tag)
+    {
+        if (nullptr == instance) { return false; }
+
+        // Skips Capture and Track, the Allocator frame is kept since it is usually inlined into the caller.
+        auto callStack = s_CaptureCallStacks.load(std::memory_order_relaxed) ? CallStack::Capture(1)
+                                                                              : CallStack::Invalid;
+
+        auto& shard = GetShard(instance);
+        {
+            std::lock_guard<SpinLock> lock(shard.Lock);
+            auto [ignore, inserted] =
+                    shard.Allocations.try_emplace(instance, AllocationRecord{size, source, tag, callStack});
+            if (!inserted) { return false; }
+        }
+
+        if (auto counters = GetThreadCounters())
+        {
+            Increment(counters->AllocatedBytes, size);
+            Increment(counters->AllocationCount, 1);
+        }
+
+        AddToTag(tag, size);
+        return true;
+    }
+
+    std::optional<AllocationRecord> AllocationTracker::Untrack(void* instance)
+    {
+        if (nullptr == instance) { return std::nullopt; }
+
+        AllocationRecord record{};
+        auto& shard = GetShard(instance);
+        {
+            std::lock_guard<SpinLock> lock(shard.Lock);
+            auto it = shard.Allocations.find(instance);
+            if (shard.Allocations.end() == it) { return std::nullopt; }
+
+            record = it->second;
+            shard.Allocations.erase(it);
+        }
+
+        if (auto counters = GetThreadCounters())
+        {
+            Increment(counters->FreedBytes, record.Size);
+            Increment(counters->FreeCount, 1);
+        }
+
+        RemoveFromTag(record.Tag, record.Size);
+        return record;
+    }
+
+    void AllocationTracker::ResizeTagRange(MemoryTag tag, size_t oldSize, size_t newSize)
+    {
+        if (oldSize == newSize) { return; }
+        if (oldSize > 0) { RemoveFromTag(tag, oldSize); }
+        if (newSize > 0) { AddToTag(tag, newSize); }
+    }
+
+    bool AllocationTracker::IsTracked(const void* instance)
+    {
+        if (nullptr == instance) { return false; }
+
+        auto& shard = GetShard(instance);
+        std::lock_guard<SpinLock> lock(shard.Lock);
+        return shard.Allocations.contains(const_cast<void*>(instance));
+    }
+
+    AllocationStats AllocationTracker::GetStats()
+    {
+        AllocationStats stats{};
+        for (auto counters = s_ThreadCountersHead.load(std::memory_order_acquire); counters;
+             counters = counters->Next)
+        {
+            stats.TotalAllocatedBytes += counters->AllocatedBytes.load(std::memory_order_relaxed);
+            stats.TotalFreedBytes += counters->FreedBytes.load(std::memory_order_relaxed);
+            stats.AllocationCount += counters->AllocationCount.load(std::memory_order_relaxed);
+            stats.FreeCount += counters->FreeCount.load(std::memory_order_relaxed);
+        }
+
+        // Counters are read without stopping other threads, clamp so a racing free can not underflow the totals.
+        stats.LiveBytes = stats.TotalAllocatedBytes > stats.TotalFreedBytes
+                                  ? stats.TotalAllocatedBytes - stats.TotalFreedBytes
+                                  : 0;
+        stats.LiveAllocations =
+                stats.AllocationCount > stats.FreeCount ? stats.AllocationCount - stats.FreeCount : 0;
+        return stats;
+    }
+
+    MemoryTagStats AllocationTracker::GetTagStats(MemoryTag tag)
+    {
+        auto& counters = s_TagCounters[static_cast<size_t>(tag)];
+
+        MemoryTagStats stats{};
+        stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+        stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+        stats.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+        stats.AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed);
+        stats.Budget.Soft = counters.SoftBudget.load(std::memory_order_relaxed);
+        stats.Budget.Hard = counters.HardBudget.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void AllocationTracker::SetBudget(MemoryTag tag, MemoryBudget budget)
+    {
+        auto& counters = s_TagCounters[static_cast<size_t>(tag)];
+        counters.SoftBudget.store(budget.Soft, std::memory_order_relaxed);
+        counters.HardBudget.store(budget.Hard, std::memory_order_relaxed);
+        counters.SoftExceeded.store(false, std::memory_order_relaxed);
+        counters.HardExceeded.store(false, std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::SetBudgetCallback(MemoryBudgetCallback callback)
+    {
+        s_BudgetCallback.store(callback ? callback : DefaultBudgetCallback, std::memory_order_release);
+    }
+
+    void AllocationTracker::SetCallStackCapture(bool enabled)
+    {
+        s_CaptureCallStacks.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool AllocationTracker::IsCapturingCallStacks() { return s_CaptureCallStacks.load(std::memory_order_relaxed); }
+
+    void AllocationTracker::ForEachAllocation(
+            const std::function<void(const void*, const AllocationRecord&)>& callback)
+    {
+        std::vector<std::pair<const void*, AllocationRecord>> records;
+        for (size_t index = 0; index < ShardCount; index++)
+        {
+            auto& shard = GetShards()[index];
+            {
+                std::lock_guard<SpinLock> lock(shard.Lock);
+                records.assign(shard.Allocations.begin(), shard.Allocations.end());
+            }
+            for (auto& [instance, record]: records) { callback(instance, record); }
+        }
+    }
+
+    ThreadAllocationStats AllocationTracker::GetCurrentThreadStats()
+    {
+        return t_ThreadCounters ? ToThreadStats(*t_ThreadCounters) : ThreadAllocationStats{};
+    }
+
+    size_t AllocationTracker::GetThreadStats(ThreadAllocationStats* stats, size_t capacity)
+    {
+        size_t count = 0;
+        for (auto counters = s_ThreadCountersHead.load(std::memory_order_acquire); counters && count < capacity;
+             counters = counters->Next)
+        {
+            stats[count++] = ToThreadStats(*counters);
+        }
+        return count;
+    }
+
+    void AllocationTracker::CountSystemAllocation(size_t size)
+    {
+        if (auto counters = GetThreadCounters())
+        {
+            Increment(counters->SystemAllocatedBytes, size);
+            Increment(counters->SystemAllocationCount, 1);
+        }
+    }
+
+    void AllocationTracker::CountSystemFree()
+    {
+        if (auto counters = GetThreadCounters()) { Increment(counters->SystemFreeCount, 1); }
+    }
+}// namespace Engine
@@ -0,0 +1,112 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * AllocationTracker class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+#include <Core/CallStack.hpp>
+#include <Core/MemoryTag.hpp>
+
+namespace Engine
+{
+    enum class AllocationSource : uint8_t
+    {
+        Heap,
+        Pool,
+        TLSF
+    };
+
+    struct AllocationRecord {
+        size_t Size{};
+        AllocationSource Source{};
+        MemoryTag Tag{};
+        CallStackId CallStack{};
+    };
+
+    /** Running totals of one thread slot, slots are reused after their thread exits. */
+    struct ThreadAllocationStats {
+        uint32_t ThreadIndex{};
+        size_t AllocatedBytes{};
+        size_t AllocationCount{};
+        size_t FreeCount{};
+        size_t SystemAllocatedBytes{};
+        size_t SystemAllocationCount{};
+        size_t SystemFreeCount{};
+    };
+
+    struct AllocationStats {
+        size_t LiveBytes{};
+        size_t LiveAllocations{};
+        size_t TotalAllocatedBytes{};
+        size_t TotalFreedBytes{};
+        size_t AllocationCount{};
+        size_t FreeCount{};
+    };
+
+    /**
+     * Bookkeeping behind Engine::Allocator.
+     *
+     * Live allocations are kept in a table split into shards by address, each shard guarded by its own spin lock,
+     * so a pointer can be freed from any thread. Byte and call counters are kept per thread and are only summed
+     * when GetStats() is called.
+     *
+     * Every allocation also carries a MemoryTag. Per tag totals are shared atomics since budgets have to be checked
+     * against the live total at the time of the allocation.
+     *
+     * With call stack capture enabled each record also keeps the hash of the stack that allocated it.
+     */
+    class AllocationTracker
+    {
+    public:
+        static bool Track(void* instance, size_t size, AllocationSource source = AllocationSource::Heap,
+                          MemoryTag tag = MemoryTagScope::GetCurrent());
+
+        static std::optional<AllocationRecord> Untrack(void* instance);
+
+        /**
+         * Moves a memory range that is not an allocation, like the committed part of a VirtualArena, from oldSize to
+         * newSize bytes in the tag totals and budgets. The range never shows up in GetStats(), snapshots or leak
+         * reports, VirtualMemory keeps its totals.
+         */
+        static void ResizeTagRange(MemoryTag tag, size_t oldSize, size_t newSize);
+
+        static bool IsTracked(const void* instance);
+
+        static AllocationStats GetStats();
+
+        static MemoryTagStats GetTagStats(MemoryTag tag);
+
+        static void SetBudget(MemoryTag tag, MemoryBudget budget);
+
+        static void SetBudgetCallback(MemoryBudgetCallback callback);
+
+        static void SetCallStackCapture(bool enabled);
+
+        static bool IsCapturingCallStacks();
+
+        static ThreadAllocationStats GetCurrentThreadStats();
+
+        /** Fills up to capacity entries without allocating, returns how many were written. */
+        static size_t GetThreadStats(ThreadAllocationStats* stats, size_t capacity);
+
+        /** Counts global operator new/delete calls, see ENGINE_ENABLE_ALLOCATION_HOOKS. */
+        static void CountSystemAllocation(size_t size);
+
+        static void CountSystemFree();
+
+        /** Visits a copy of every live record, the callback may allocate. */
+        static void ForEachAllocation(const std::function<void(const void*, const AllocationRecord&)>& callback);
+    };
+}// namespace Engine
@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Allocator class implementation
+ */
+
+#include "Allocator.hpp"
+#include <Core/Log.hpp>
+
+namespace Engine
+{
+    void Allocator::Init(const AllocatorSpec& spec)
+    {
+        // Allocations made before the switch keep their source and are still released through it.
+        s_Backend = spec.Backend;
+        AllocationTracker::SetCallStackCapture(spec.CaptureCallStacks);
+        if (AllocatorBackend::TLSF == spec.Backend) { GetHeap().Init(spec.RegionSize); }
+    }
+
+    AllocatorBackend Allocator::GetBackend() { return s_Backend; }
+
+    AllocationStats Allocator::GetStats() { return AllocationTracker::GetStats(); }
+
+    TLSFHeapStats Allocator::GetHeapStats() { return GetHeap().GetStats(); }
+
+    VirtualMemoryStats Allocator::GetVirtualMemoryStats() { return VirtualMemory::GetStats(); }
+
+    MemoryTagStats Allocator::GetTagStats(MemoryTag tag) { return AllocationTracker::GetTagStats(tag); }
+
+    void Allocator::SetBudget(MemoryTag tag, MemoryBudget budget) { AllocationTracker::SetBudget(tag, budget); }
+
+    void Allocator::SetBudgetCallback(MemoryBudgetCallback callback) { AllocationTracker::SetBudgetCallback(callback); }
+
+    size_t Allocator::GetAllocatedMemorySize() { return AllocationTracker::GetStats().LiveBytes; }
+
+    void Allocator::LogStats()
+    {
+        auto stats = AllocationTracker::GetStats();
+        LOG_MEMORY_ALLOC("Live: %zuB in %zu allocations\n", stats.LiveBytes, stats.LiveAllocations);
+        LOG_MEMORY_ALLOC("Total: %zuB allocated, %zuB freed, %zu allocations, %zu frees\n",
+                         stats.TotalAllocatedBytes, stats.TotalFreedBytes, stats.AllocationCount, stats.FreeCount);
+
+        for (size_t index = 0; index < MemoryTagCount; index++)
+        {
+            auto tag = static_cast<MemoryTag>(index);
+            auto tagStats = AllocationTracker::GetTagStats(tag);
+            LOG_MEMORY_ALLOC("    %-10s live %zuB, peak %zuB, %zu live of %zu allocations\n", MemoryTagToString(tag),
+                             tagStats.LiveBytes, tagStats.PeakBytes, tagStats.LiveAllocations,
+                             tagStats.AllocationCount);
+        }
+
+        auto poolStats = PoolAllocator::GetStats();
+        LOG_MEMORY_ALLOC("Pool: %zuB live in %zuB reserved, %.1f%% internal, %.1f%% external fragmentation\n",
+                         poolStats.LiveBytes, poolStats.ReservedBytes, poolStats.InternalFragmentation * 100.0,
+                         poolStats.ExternalFragmentation * 100.0);
+
+        if (AllocatorBackend::TLSF == s_Backend)
+        {
+            auto heapStats = GetHeap().GetStats();
+            LOG_MEMORY_ALLOC("TLSF: %zuB used, %zuB high water mark, %zuB reserved, %.1f%% fragmentation\n",
+                             heapStats.UsedBytes, heapStats.HighWaterMark, heapStats.ReservedBytes,
+                             heapStats.Fragmentation * 100.0);
+        }
+
+        auto virtualStats = VirtualMemory::GetStats();
+        if (virtualStats.ReservationCount > 0)
+        {
+            LOG_MEMORY_ALLOC("Virtual: %zuB committed of %zuB reserved in %zu ranges\n", virtualStats.CommittedBytes,
+                             virtualStats.ReservedBytes, virtualStats.ReservationCount);
+        }
+    }
+
+    void Allocator::SetCallStackCapture(bool enabled) { AllocationTracker::SetCallStackCapture(enabled); }
+
+    MemorySnapshot Allocator::TakeSnapshot() { return MemorySnapshot::Take(); }
+
+    void Allocator::ReportLeaks()
+    {
+        auto snapshot = MemorySnapshot::Take();
+        if (0 == snapshot.GetTotalCount())
+        {
+            LOG_MEMORY_ALLOC("No leaks detected\n");
+            return;
+        }
+
+        LOG_WARNING("Leaked allocations:\n");
+        snapshot.Log(snapshot.GetEntries().size());
+    }
+
+    AllocationSource Allocator::SelectSource(size_t size, size_t alignment, bool pooled)
+    {
+        if (pooled && PoolAllocator::CanAllocate(size, alignment)) { return AllocationSource::Pool; }
+        if (AllocatorBackend::TLSF == s_Backend && alignment <= TLSFHeap::Alignment) { return AllocationSource::TLSF; }
+        return AllocationSource::Heap;
+    }
+
+    void* Allocator::AllocateMemory(size_t size, AllocationSource source)
+    {
+        switch (source)
+        {
+            case AllocationSource::Pool:
+                return PoolAllocator::Allocate(size);
+            case AllocationSource::TLSF:
+                return GetHeap().Allocate(size);
+            default:
+                return ::operator new(size);
+        }
+    }
+
+    void Allocator::DeallocateMemory(void* memory, const AllocationRecord& record)
+    {
+        switch (record.Source)
+        {
+            case AllocationSource::Pool:
+                PoolAllocator::Deallocate(memory, record.Size);
+                break;
+            case AllocationSource::TLSF:
+                GetHeap().Deallocate(memory);
+                break;
+            default:
+                ::operator delete(memory);
+                break;
+        }
+    }
+
+    TLSFHeap& Allocator::GetHeap()
+    {
+        // Never destroyed, allocations may still be released from static destructors.
+        static TLSFHeap* heap = new TLSFHeap();
+        return *heap;
+    }
+}// namespace Engine
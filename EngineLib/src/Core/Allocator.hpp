@@ -1,9 +1,29 @@
 #pragma once
-#include <unordered_map>
 #include <cstdint>
+#include <type_traits>
+#include <Core/AllocationTracker.hpp>
+#include <Core/MemorySnapshot.hpp>
+#include <Core/PoolAllocator.hpp>
+#include <Core/TLSFHeap.hpp>
+#include <Core/VirtualArena.hpp>
+
+class RefCounted;
+class LocalRefCounted;
 
 namespace Engine
 {
+    enum class AllocatorBackend
+    {
+        Heap,
+        TLSF
+    };
+
+    struct AllocatorSpec {
+        AllocatorBackend Backend = AllocatorBackend::Heap;
+        size_t RegionSize = TLSFHeap::DefaultRegionSize;
+        bool CaptureCallStacks = false;
+    };
+
     class Allocator
     {
     public:
@@ -11,11 +31,16 @@ namespace Engine
         ~Allocator() = default;
 
     public:
+        static void Init(const AllocatorSpec& spec);
+
         template <typename T, typename... Args>
         static T* Allocate(Args&&... args);
 
+        template <typename T, typename... Args>
+        static T* AllocateTagged(MemoryTag tag, Args&&... args);
+
         template <typename T>
-        static T* AllocateArray(const size_t size);
+        static T* AllocateArray(const size_t size, MemoryTag tag = MemoryTagScope::GetCurrent());
 
         template <typename T, size_t size = sizeof(T)>
         static void AddToAllocatedMemory(T* instance = nullptr);
@@ -32,11 +57,52 @@ namespace Engine
         template <typename T>
         static size_t Copy(T* destination, T* source, size_t size);
 
+    public:
+        static AllocatorBackend GetBackend();
+
+        static AllocationStats GetStats();
+
+        static TLSFHeapStats GetHeapStats();
+
+        static VirtualMemoryStats GetVirtualMemoryStats();
+
+        static MemoryTagStats GetTagStats(MemoryTag tag);
+
+        static void SetBudget(MemoryTag tag, MemoryBudget budget);
+
+        static void SetBudgetCallback(MemoryBudgetCallback callback);
+
+        static size_t GetAllocatedMemorySize();
+
+        static void LogStats();
+
+        static void SetCallStackCapture(bool enabled);
+
+        static MemorySnapshot TakeSnapshot();
+
+        static void ReportLeaks();
+
+    private:
+        template <typename T>
+        static void* GetAllocationAddress(T* instance);
+
+        static AllocationSource SelectSource(size_t size, size_t alignment, bool pooled);
+
+        static void* AllocateMemory(size_t size, AllocationSource source);
+
+        static void DeallocateMemory(void* memory, const AllocationRecord& record);
+
+        static TLSFHeap& GetHeap();
+
+        template <typename T>
+        static constexpr bool IsPooled =
+                (std::is_base_of_v<RefCounted, T> || std::is_base_of_v<LocalRefCounted, T>) &&
+                PoolAllocator::CanAllocate(sizeof(T), alignof(T));
+
     private:
-        inline static size_t s_AllocatedMemorySize{};
-        inline static std::unordered_map<void*, size_t> s_AllocatedMemory{};
+        inline static AllocatorBackend s_Backend{AllocatorBackend::Heap};
     };
 
 }// namespace Engine
 
-#include <Core/Allocator.impl.hpp>
\ No newline at end of file
+#include <Core/Allocator.impl.hpp>
@@ -1,5 +1,7 @@
 #pragma once
 #include <algorithm>
+#include <memory>
+#include <new>
 #include <Core/Allocator.hpp>
 #include <Core/Log.hpp>
 #include "Allocator.hpp"
@@ -9,65 +11,91 @@ namespace Engine
     template <typename T, typename... Args>
     T* Allocator::Allocate(Args&&... args)
     {
-        auto ptr = new T(std::forward<Args>(args)...);
-        LOG_MEMORY_ALLOC("Allocated %ziB\n", sizeof(T));
+        auto source = SelectSource(sizeof(T), alignof(T), IsPooled<T>);
+        void* memory = AllocationSource::Heap == source ? nullptr : AllocateMemory(sizeof(T), source);
 
-        s_AllocatedMemorySize += sizeof(T);
-        s_AllocatedMemory[ptr] = sizeof(T);
+        // A backend that can not grow falls back to the heap, which throws std::bad_alloc when it is out as well.
+        if (!memory) { source = AllocationSource::Heap; }
+        auto ptr = memory ? new (memory) T(std::forward<Args>(args)...) : new T(std::forward<Args>(args)...);
+
+        AllocationTracker::Track(ptr, sizeof(T), source);
         return ptr;
     }
 
+    template <typename T, typename... Args>
+    T* Allocator::AllocateTagged(MemoryTag tag, Args&&... args)
+    {
+        MemoryTagScope scope(tag);
+        return Allocate<T>(std::forward<Args>(args)...);
+    }
+
     template <typename T>
-    inline T* Allocator::AllocateArray(size_t size)
+    inline T* Allocator::AllocateArray(size_t size, MemoryTag tag)
     {
-        auto ptr = new T[size];
-        LOG_MEMORY_ALLOC("Allocated %ziB\n", sizeof(T));
+        // Backend arrays are released without knowing the element count, so only trivially destructible ones.
+        auto source = std::is_trivially_destructible_v<T> ? SelectSource(sizeof(T) * size, alignof(T), false)
+                                                          : AllocationSource::Heap;
+
+        T* ptr{};
+        if (AllocationSource::Heap != source) { ptr = static_cast<T*>(AllocateMemory(sizeof(T) * size, source)); }
 
-        s_AllocatedMemorySize += sizeof(T);
-        s_AllocatedMemory[ptr] = sizeof(T);
+        if (ptr) { std::uninitialized_default_construct_n(ptr, size); }
+        else
+        {
+            source = AllocationSource::Heap;
+            ptr = new T[size];
+        }
+
+        AllocationTracker::Track(ptr, sizeof(T) * size, source, tag);
         return ptr;
     }
 
     template <typename T, size_t size>
     void Allocator::AddToAllocatedMemory(T* instance)
     {
-        if (instance)
-        {
-            auto [ignore, inserted] = s_AllocatedMemory.try_emplace(instance, size);
-            if (inserted) { s_AllocatedMemorySize += size; }
-        }
+        AllocationTracker::Track(GetAllocationAddress(instance), size);
     }
 
     template <typename T>
     void Allocator::Deallocate(T* instance)
     {
-        if (s_AllocatedMemory.find(instance) != s_AllocatedMemory.end())
-        {
-            s_AllocatedMemorySize -= s_AllocatedMemory[instance];
-            delete instance;
-            LOG_MEMORY_ALLOC("Deallocated %ziB\n", s_AllocatedMemory[instance]);
+        auto address = GetAllocationAddress(instance);
+        auto record = AllocationTracker::Untrack(address);
+        if (!record) { return; }
 
-            s_AllocatedMemory.erase(instance);
+        if (AllocationSource::Heap == record->Source) { delete instance; }
+        else
+        {
+            instance->~T();
+            DeallocateMemory(address, *record);
         }
     }
 
     template <typename T>
     void Allocator::DeallocateArray(T* instance)
     {
-        if (s_AllocatedMemory.find(instance) != s_AllocatedMemory.end())
-        {
-            s_AllocatedMemorySize -= s_AllocatedMemory[instance];
-            delete[] instance;
-            LOG_MEMORY_ALLOC("Deallocated %ziB\n", s_AllocatedMemory[instance]);
+        auto record = AllocationTracker::Untrack(instance);
+        if (!record) { return; }
 
-            s_AllocatedMemory.erase(instance);
-        }
+        if (AllocationSource::Heap == record->Source) { delete[] instance; }
+        else { DeallocateMemory(instance, *record); }
     }
 
     template <typename T>
     bool Allocator::IsLive(T* instance)
     {
-        return s_AllocatedMemory.find(instance) != s_AllocatedMemory.end();
+        return AllocationTracker::IsTracked(GetAllocationAddress(instance));
+    }
+
+    template <typename T>
+    void* Allocator::GetAllocationAddress(T* instance)
+    {
+        // Objects are tracked by the address of the most derived object, the one that was allocated.
+        if constexpr (std::is_polymorphic_v<T>)
+        {
+            return instance ? dynamic_cast<void*>(instance) : nullptr;
+        }
+        else { return instance; }
     }
 
     template <typename T>
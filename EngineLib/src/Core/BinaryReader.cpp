@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryReader class implementation
+ */
+
+#include "BinaryReader.hpp"
+#include <Core/Log.hpp>
+
+namespace Engine
+{
+    std::expected<BinaryHeader, ErrorStatus> BinaryReader::ReadHeader(uint32_t magic, uint32_t minVersion,
+                                                                      uint32_t maxVersion)
+    {
+        auto header = ReadAligned<BinaryHeader>();
+        if (!IsValid() || magic != header.Magic)
+        {
+            LOG_ERROR("Binary header magic mismatch!\n");
+            m_Failed = true;
+            return std::unexpected(ErrorStatus::Invalid);
+        }
+        if (header.Version < minVersion || header.Version > maxVersion)
+        {
+            LOG_ERROR("Binary version %u is not supported, expected %u to %u!\n", header.Version, minVersion,
+                      maxVersion);
+            m_Failed = true;
+            return std::unexpected(ErrorStatus::Invalid);
+        }
+        return header;
+    }
+
+    std::string_view BinaryReader::ReadString()
+    {
+        auto size = ReadVarUInt();
+        if (size > GetRemaining())
+        {
+            m_Failed = true;
+            return {};
+        }
+
+        auto bytes = ReadBytes(static_cast<uint32_t>(size));
+        return {reinterpret_cast<const char*>(bytes.Data()), bytes.GetSize()};
+    }
+
+    BufferView BinaryReader::ReadBytes(uint32_t size)
+    {
+        auto data = Consume(size);
+        return data ? BufferView{data, size} : BufferView{};
+    }
+
+    uint64_t BinaryReader::ReadVarUInt()
+    {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            auto data = Consume(1);
+            if (nullptr == data) { return 0; }
+
+            value |= static_cast<uint64_t>(*data & 0x7F) << shift;
+            if (0 == (*data & 0x80)) { return value; }
+        }
+
+        // More than ten bytes can not come from WriteVarUInt.
+        m_Failed = true;
+        return 0;
+    }
+
+    int64_t BinaryReader::ReadVarInt()
+    {
+        auto value = ReadVarUInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void BinaryReader::Align(uint32_t alignment) { Skip((alignment - m_Offset % alignment) % alignment); }
+
+    void BinaryReader::Skip(uint32_t size) { Consume(size); }
+
+    const uint8_t* BinaryReader::Consume(uint32_t size)
+    {
+        if (m_Failed || size > GetRemaining())
+        {
+            m_Failed = true;
+            return nullptr;
+        }
+
+        auto data = m_Source.Data() + m_Offset;
+        m_Offset += size;
+        return data;
+    }
+}// namespace Engine
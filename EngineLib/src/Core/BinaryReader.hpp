@@ -0,0 +1,83 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryReader class definition
+ */
+
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <Core/BinaryWriter.hpp>
+#include <Core/BufferView.hpp>
+#include <Core/Error.hpp>
+
+namespace Engine
+{
+    /**
+     * Reads data written by BinaryWriter from a view, usually of a Buffer or MappedBuffer.
+     *
+     * Arrays, strings and byte ranges are returned as views into the source, nothing is copied. Reading past the end
+     * or a malformed varint puts the reader into a failed state: the read returns a default value or an empty view,
+     * later reads do the same, and IsValid() reports false. Check it once after a batch of reads.
+     */
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(BufferView source) : m_Source(source) {}
+        ~BinaryReader() = default;
+
+    public:
+        /** Fails when the magic differs or the version is outside [minVersion, maxVersion]. */
+        std::expected<BinaryHeader, ErrorStatus> ReadHeader(uint32_t magic, uint32_t minVersion,
+                                                            uint32_t maxVersion);
+
+        template <typename T>
+        T Read();
+
+        template <typename T>
+        T ReadAligned();
+
+        /** Views the elements in place, the source has to be aligned for T. */
+        template <typename T>
+        std::span<const T> ReadArray();
+
+        std::string_view ReadString();
+
+        BufferView ReadBytes(uint32_t size);
+
+        uint64_t ReadVarUInt();
+
+        int64_t ReadVarInt();
+
+        void Align(uint32_t alignment);
+
+        void Skip(uint32_t size);
+
+    public:
+        bool IsValid() const { return !m_Failed; }
+
+        uint32_t GetOffset() const { return m_Offset; }
+
+        uint32_t GetRemaining() const { return m_Source.GetSize() - m_Offset; }
+
+    private:
+        const uint8_t* Consume(uint32_t size);
+
+    private:
+        BufferView m_Source;
+        uint32_t m_Offset{};
+        bool m_Failed{};
+    };
+}// namespace Engine
+
+#include "BinaryReader.impl.hpp"
@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryReader templated functions implementation
+ */
+
+#include <cstring>
+#include "BinaryReader.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    T BinaryReader::Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read from bytes!");
+        T value{};
+        if (auto data = Consume(sizeof(T))) { memcpy(&value, data, sizeof(T)); }
+        return value;
+    }
+
+    template <typename T>
+    T BinaryReader::ReadAligned()
+    {
+        Align(alignof(T));
+        return Read<T>();
+    }
+
+    template <typename T>
+    std::span<const T> BinaryReader::ReadArray()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be viewed as bytes!");
+        auto count = ReadVarUInt();
+        Align(alignof(T));
+        if (count > GetRemaining() / sizeof(T))
+        {
+            m_Failed = true;
+            return {};
+        }
+
+        auto data = Consume(static_cast<uint32_t>(count * sizeof(T)));
+        if (nullptr == data || 0 != reinterpret_cast<uintptr_t>(data) % alignof(T))
+        {
+            m_Failed = true;
+            return {};
+        }
+        return {reinterpret_cast<const T*>(data), static_cast<size_t>(count)};
+    }
+}// namespace Engine
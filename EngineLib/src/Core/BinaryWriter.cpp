@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryWriter class implementation
+ */
+
+#include "BinaryWriter.hpp"
+
+#include <algorithm>
+
+namespace Engine
+{
+    BinaryWriter::BinaryWriter(uint32_t capacity) { m_Buffer.Allocate(std::max(capacity, 16u)); }
+
+    void BinaryWriter::WriteHeader(BinaryHeader header) { WriteAligned(header); }
+
+    void BinaryWriter::WriteString(std::string_view value)
+    {
+        WriteVarUInt(value.size());
+        WriteBytes({reinterpret_cast<const uint8_t*>(value.data()), static_cast<uint32_t>(value.size())});
+    }
+
+    void BinaryWriter::WriteBytes(BufferView bytes)
+    {
+        if (bytes.Empty()) { return; }
+        memcpy(Reserve(bytes.GetSize()), bytes.Data(), bytes.GetSize());
+    }
+
+    void BinaryWriter::WriteVarUInt(uint64_t value)
+    {
+        // LEB128, seven bits per byte with the high bit marking that more follow.
+        uint8_t bytes[10];
+        uint32_t count = 0;
+        do {
+            bytes[count] = static_cast<uint8_t>(value & 0x7F);
+            value >>= 7;
+            if (value) { bytes[count] |= 0x80; }
+            count++;
+        } while (value);
+        memcpy(Reserve(count), bytes, count);
+    }
+
+    void BinaryWriter::WriteVarInt(int64_t value)
+    {
+        WriteVarUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void BinaryWriter::Align(uint32_t alignment)
+    {
+        auto padding = (alignment - m_Offset % alignment) % alignment;
+        if (padding > 0) { memset(Reserve(padding), 0, padding); }
+    }
+
+    BufferView BinaryWriter::GetView() const { return {m_Buffer.Data, m_Offset}; }
+
+    uint32_t BinaryWriter::GetSize() const { return m_Offset; }
+
+    Buffer BinaryWriter::Release()
+    {
+        m_Buffer.Size = m_Offset;
+        m_Offset = 0;
+        return std::move(m_Buffer);
+    }
+
+    uint8_t* BinaryWriter::Reserve(uint32_t size)
+    {
+        if (m_Offset + size > m_Buffer.Size)
+        {
+            // Grows geometrically, the old bytes move over in one copy.
+            Buffer grown;
+            grown.Allocate(std::max({m_Buffer.Size * 2, m_Offset + size, 16u}));
+            if (m_Offset > 0) { memcpy(grown.Data, m_Buffer.Data, m_Offset); }
+            m_Buffer = std::move(grown);
+        }
+
+        auto data = m_Buffer.Data + m_Offset;
+        m_Offset += size;
+        return data;
+    }
+}// namespace Engine
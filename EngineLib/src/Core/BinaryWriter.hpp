@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryWriter class definition
+ */
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <Core/Buffer.hpp>
+#include <Core/BufferView.hpp>
+
+namespace Engine
+{
+    /** Leads versioned files, checked by BinaryReader::ReadHeader. */
+    struct BinaryHeader {
+        uint32_t Magic{};
+        uint32_t Version{};
+    };
+
+    /**
+     * Appends binary data to a growing Buffer.
+     *
+     * Values are written in native byte order. Aligned writes and arrays pad relative to the start of the stream, so a
+     * reader over memory at least as aligned as the values (Buffer, MappedBuffer) can view arrays in place. Arrays and
+     * strings carry a varint length prefix.
+     */
+    class BinaryWriter
+    {
+    public:
+        static constexpr uint32_t DefaultCapacity = 4096;
+
+    public:
+        explicit BinaryWriter(uint32_t capacity = DefaultCapacity);
+        ~BinaryWriter() = default;
+
+        BinaryWriter(const BinaryWriter&) = delete;
+        BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+    public:
+        void WriteHeader(BinaryHeader header);
+
+        template <typename T>
+        void Write(const T& value);
+
+        /** Pads to alignof(T) first. */
+        template <typename T>
+        void WriteAligned(const T& value);
+
+        /** Length prefix, padding to alignof(T), then all elements in one copy. */
+        template <typename T>
+        void WriteArray(std::span<const T> values);
+
+        void WriteString(std::string_view value);
+
+        void WriteBytes(BufferView bytes);
+
+        void WriteVarUInt(uint64_t value);
+
+        /** Zigzag encoded so small negative numbers stay short. */
+        void WriteVarInt(int64_t value);
+
+        void Align(uint32_t alignment);
+
+    public:
+        BufferView GetView() const;
+
+        uint32_t GetSize() const;
+
+        /** Hands the written bytes over, the writer starts over empty. */
+        Buffer Release();
+
+    private:
+        uint8_t* Reserve(uint32_t size);
+
+    private:
+        Buffer m_Buffer;
+        uint32_t m_Offset{};
+    };
+}// namespace Engine
+
+#include "BinaryWriter.impl.hpp"
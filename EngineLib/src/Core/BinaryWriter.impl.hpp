@@ -0,0 +1,42 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BinaryWriter templated functions implementation
+ */
+
+#include <cstring>
+#include "BinaryWriter.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    void BinaryWriter::Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as bytes!");
+        memcpy(Reserve(sizeof(T)), &value, sizeof(T));
+    }
+
+    template <typename T>
+    void BinaryWriter::WriteAligned(const T& value)
+    {
+        Align(alignof(T));
+        Write(value);
+    }
+
+    template <typename T>
+    void BinaryWriter::WriteArray(std::span<const T> values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as bytes!");
+        WriteVarUInt(values.size());
+        Align(alignof(T));
+        if (values.empty()) { return; }
+        memcpy(Reserve(static_cast<uint32_t>(values.size_bytes())), values.data(), values.size_bytes());
+    }
+}// namespace Engine
@@ -11,6 +11,7 @@
 
 #include "Buffer.hpp"
 #include <Core/Allocator.hpp>
+#include <cstring>
 
 namespace Engine
 {
@@ -19,10 +20,22 @@ namespace Engine
 
     Buffer::Buffer(uint8_t* data, uint32_t size) : Data(data), Size(size) {}
 
-    Buffer::Buffer(const Buffer& other)
+    Buffer::Buffer(Buffer&& other) noexcept : Data(other.Data), Size(other.Size)
     {
+        other.Data = nullptr;
+        other.Size = 0;
+    }
+
+    Buffer& Buffer::operator=(Buffer&& other) noexcept
+    {
+        if (this == &other) { return *this; }
+
+        Release();
         Data = other.Data;
         Size = other.Size;
+        other.Data = nullptr;
+        other.Size = 0;
+        return *this;
     }
 
     Buffer::~Buffer()
@@ -34,18 +47,21 @@ namespace Engine
     {
         Buffer buffer;
         buffer.Allocate(size);
-        memcpy(buffer.Data, data, size);
+        if (size > 0) { memcpy(buffer.Data, data, size); }
         return buffer;
     }
 
-    void Buffer::Allocate(uint32_t size)
+    Buffer Buffer::Copy(BufferView view) { return Copy(view.Data(), view.GetSize()); }
+
+    void Buffer::Allocate(uint32_t size, MemoryTag tag)
     {
         if (Data) { Allocator::DeallocateArray(Data); }
         Data = nullptr;
+        Size = 0;
 
         if (size == 0) return;
 
-        Data = Allocator::AllocateArray<uint8_t>(size);
+        Data = Allocator::AllocateArray<uint8_t>(size, tag);
         Size = size;
     }
 
@@ -61,22 +77,26 @@ namespace Engine
         for (size_t i = 0; i < Size; i++) { Data[i] = 0; }
     }
 
-    uint8_t* Buffer::ReadBytes(uint32_t size, uint32_t offset)
+    BufferView Buffer::ReadBytes(uint32_t size, uint32_t offset) const
     {
         assert(offset + size <= Size);
-        uint8_t* buffer = Allocator::AllocateArray<uint8_t>(size);
-        memcpy(buffer, (uint8_t*) Data + offset, size);
-        return buffer;
+        return {Data + offset, size};
     }
 
-    void Buffer::Write(uint8_t* data, uint32_t size, uint32_t offset)
+    BufferView Buffer::GetView() const { return {Data, Size}; }
+
+    void Buffer::Write(const uint8_t* data, uint32_t size, uint32_t offset)
     {
         assert(offset + size <= Size);
         memcpy((uint8_t*) Data + offset, data, size);
     }
 
+    void Buffer::Write(BufferView data, uint32_t offset) { Write(data.Data(), data.GetSize(), offset); }
+
     Buffer::operator bool() const { return Data; }
 
+    Buffer::operator BufferView() const { return {Data, Size}; }
+
     uint8_t& Buffer::operator[](int index) { return ((uint8_t*) Data)[index]; }
 
     uint8_t Buffer::operator[](int index) const { return ((uint8_t*) Data)[index]; }
@@ -15,33 +15,52 @@
 #include <cassert>
 #include <cstdint>
 
+#include "BufferView.hpp"
 #include "Log.hpp"
+#include "MemoryTag.hpp"
 #include "Ref.hpp"
 
 namespace Engine
 {
+    /**
+     * Uniquely owned byte array, moves hand the bytes over and copies have to be made explicitly with Copy().
+     * Use SharedBuffer to share one payload between several owners.
+     */
     class Buffer: public RefCounted
     {
     public:
         Buffer();
 
+        /** Takes ownership of data allocated with Allocator::AllocateArray. */
         Buffer(uint8_t* data, uint32_t size);
 
-        Buffer(const Buffer& other);
+        Buffer(const Buffer& other) = delete;
+        Buffer& operator=(const Buffer& other) = delete;
+
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+
         ~Buffer();
 
     public:
         static Buffer Copy(const uint8_t* data, uint32_t size);
 
-        void Allocate(uint32_t size);
+        static Buffer Copy(BufferView view);
+
+        void Allocate(uint32_t size, MemoryTag tag = MemoryTagScope::GetCurrent());
 
         void Release();
 
         void ZeroInitialize();
 
-        uint8_t* ReadBytes(uint32_t size, uint32_t offset);
+        /** View into the buffer, valid until the buffer is released or reallocated. */
+        BufferView ReadBytes(uint32_t size, uint32_t offset) const;
 
-        void Write(uint8_t* data, uint32_t size, uint32_t offset = 0);
+        BufferView GetView() const;
+
+        void Write(const uint8_t* data, uint32_t size, uint32_t offset = 0);
+
+        void Write(BufferView data, uint32_t offset = 0);
 
         uint32_t GetSize() const;
 
@@ -57,6 +76,8 @@ namespace Engine
     public:
         operator bool() const;
 
+        operator BufferView() const;
+
         uint8_t& operator[](int index);
         uint8_t operator[](int index) const;
 
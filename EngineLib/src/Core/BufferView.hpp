@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * BufferView class definition
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace Engine
+{
+    /**
+     * Non owning read only view of a byte range, the memory has to outlive the view.
+     * Slicing and reading never copy the underlying bytes.
+     */
+    class BufferView
+    {
+    public:
+        constexpr BufferView() = default;
+
+        constexpr BufferView(const uint8_t* data, uint32_t size) : m_Data(data), m_Size(size) {}
+
+        constexpr BufferView(std::span<const uint8_t> bytes)
+            : m_Data(bytes.data()), m_Size(static_cast<uint32_t>(bytes.size()))
+        {
+        }
+
+    public:
+        constexpr const uint8_t* Data() const { return m_Data; }
+
+        constexpr uint32_t GetSize() const { return m_Size; }
+
+        constexpr bool Empty() const { return 0 == m_Size; }
+
+        /** Clamped to the view, asking past the end gives a shorter or empty view. */
+        constexpr BufferView Slice(uint32_t offset, uint32_t size = UINT32_MAX) const
+        {
+            if (offset >= m_Size) { return {}; }
+            return {m_Data + offset, size < m_Size - offset ? size : m_Size - offset};
+        }
+
+        /** Copies the value out, so the offset does not have to be aligned for T. */
+        template <typename T>
+        T Read(uint32_t offset = 0) const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read from bytes!");
+            assert(offset + sizeof(T) <= m_Size);
+            T value;
+            memcpy(&value, m_Data + offset, sizeof(T));
+            return value;
+        }
+
+        /** Reinterprets the whole view, the data has to be aligned for T. */
+        template <typename T>
+        std::span<const T> As() const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be viewed as bytes!");
+            assert(0 == reinterpret_cast<uintptr_t>(m_Data) % alignof(T));
+            return {reinterpret_cast<const T*>(m_Data), m_Size / sizeof(T)};
+        }
+
+    public:
+        constexpr uint8_t operator[](uint32_t index) const { return m_Data[index]; }
+
+        constexpr const uint8_t* begin() const { return m_Data; }
+
+        constexpr const uint8_t* end() const { return m_Data + m_Size; }
+
+        constexpr operator std::span<const uint8_t>() const { return {m_Data, m_Size}; }
+
+        constexpr explicit operator bool() const { return nullptr != m_Data && 0 != m_Size; }
+
+    private:
+        const uint8_t* m_Data{};
+        uint32_t m_Size{};
+    };
+}// namespace Engine
@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * CallStack class implementation
+ */
+
+#ifdef _WIN32
+#include <Platform/WindowInstance.hpp>
+#include <DbgHelp.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "dbghelp.lib")
+#endif
+#else
+#include <cstdlib>
+#include <execinfo.h>
+#endif
+
+#include "CallStack.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace Engine
+{
+    namespace
+    {
+        struct CallStackFrames {
+            std::array<void*, CallStack::MaxFrames> Frames{};
+            uint32_t Count{};
+        };
+
+        std::mutex s_CallStacksLock;
+        std::unordered_map<CallStackId, CallStackFrames> s_CallStacks;
+
+#ifdef _WIN32
+        // DbgHelp is not thread safe.
+        std::mutex s_SymbolsLock;
+#endif
+
+        CallStackId HashFrames(void* const* frames, uint32_t count)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (uint32_t index = 0; index < count; index++)
+            {
+                hash ^= reinterpret_cast<uintptr_t>(frames[index]);
+                hash *= 0x100000001b3ull;
+            }
+            return hash ? hash : 1;
+        }
+    }// namespace
+
+    CallStackId CallStack::Capture(uint32_t skipFrames)
+    {
+        CallStackFrames stack{};
+
+#ifdef _WIN32
+        stack.Count = RtlCaptureStackBackTrace(skipFrames + 1, MaxFrames, stack.Frames.data(), nullptr);
+#else
+        std::array<void*, MaxFrames + 8> frames{};
+        auto captured = static_cast<uint32_t>(backtrace(frames.data(), static_cast<int>(frames.size())));
+        auto skipped = std::min(captured, skipFrames + 1);
+        stack.Count = std::min<uint32_t>(captured - skipped, MaxFrames);
+        std::copy_n(frames.begin() + skipped, stack.Count, stack.Frames.begin());
+#endif
+        if (0 == stack.Count) { return Invalid; }
+
+        auto id = HashFrames(stack.Frames.data(), stack.Count);
+
+        std::lock_guard<std::mutex> lock(s_CallStacksLock);
+        s_CallStacks.try_emplace(id, stack);
+        return id;
+    }
+
+    std::vector<std::string> CallStack::Symbolize(CallStackId id)
+    {
+        CallStackFrames stack{};
+        {
+            std::lock_guard<std::mutex> lock(s_CallStacksLock);
+            auto it = s_CallStacks.find(id);
+            if (s_CallStacks.end() == it) { return {}; }
+            stack = it->second;
+        }
+
+        std::vector<std::string> symbols;
+        symbols.reserve(stack.Count);
+
+#ifdef _WIN32
+        static std::once_flag symbolsInitialized;
+        std::call_once(symbolsInitialized, [] {
+            SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+            SymInitialize(GetCurrentProcess(), nullptr, TRUE);
+        });
+
+        std::array<uint8_t, sizeof(SYMBOL_INFO) + MAX_SYM_NAME> symbolStorage{};
+        auto symbol = reinterpret_cast<SYMBOL_INFO*>(symbolStorage.data());
+
+        std::lock_guard<std::mutex> lock(s_SymbolsLock);
+        for (uint32_t index = 0; index < stack.Count; index++)
+        {
+            auto address = reinterpret_cast<DWORD64>(stack.Frames[index]);
+            symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+            symbol->MaxNameLen = MAX_SYM_NAME;
+
+            char line[1024]{};
+            DWORD64 displacement{};
+            if (SymFromAddr(GetCurrentProcess(), address, &displacement, symbol))
+            {
+                IMAGEHLP_LINE64 lineInfo{};
+                lineInfo.SizeOfStruct = sizeof(lineInfo);
+                DWORD lineDisplacement{};
+                if (SymGetLineFromAddr64(GetCurrentProcess(), address, &lineDisplacement, &lineInfo))
+                {
+                    snprintf(line, sizeof(line), "%s (%s:%lu)", symbol->Name, lineInfo.FileName, lineInfo.LineNumber);
+                }
+                else { snprintf(line, sizeof(line), "%s + 0x%llx", symbol->Name, displacement); }
+            }
+            else { snprintf(line, sizeof(line), "0x%llx", address); }
+            symbols.emplace_back(line);
+        }
+#else
+        auto names = backtrace_symbols(stack.Frames.data(), static_cast<int>(stack.Count));
+        for (uint32_t index = 0; index < stack.Count; index++)
+        {
+            if (names) { symbols.emplace_back(names[index]); }
+            else
+            {
+                char line[32]{};
+                snprintf(line, sizeof(line), "%p", stack.Frames[index]);
+                symbols.emplace_back(line);
+            }
+        }
+        free(names);
+#endif
+        return symbols;
+    }
+}// namespace Engine
@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * CallStack class definition
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    using CallStackId = uint64_t;
+
+    /**
+     * Captures return addresses into a process wide table of unique stacks and hands out a 64 bit hash for them.
+     * Stacks are only turned into names when Symbolize() is called, typically while writing a report.
+     */
+    class CallStack
+    {
+    public:
+        static constexpr uint32_t MaxFrames = 16;
+        static constexpr CallStackId Invalid = 0;
+
+    public:
+        static CallStackId Capture(uint32_t skipFrames = 1);
+
+        static std::vector<std::string> Symbolize(CallStackId id);
+    };
+}// namespace Engine
@@ -0,0 +1,191 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Clock class implementation
+ */
+
+#ifdef _WIN32
+#include <Platform/WindowInstance.hpp>
+#else
+#include <time.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ENGINE_CLOCK_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define ENGINE_CLOCK_TSC
+#endif
+
+#include "Clock.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Engine
+{
+    namespace
+    {
+        /** Long enough that the jitter of the clock reads is a few parts per million. */
+        constexpr uint64_t CalibrationMs = 20;
+
+        struct ClockSource {
+            bool UseTsc{};
+            uint64_t Frequency{};
+        };
+
+        uint64_t ReadOsTicks()
+        {
+#ifdef _WIN32
+            LARGE_INTEGER counter;
+            QueryPerformanceCounter(&counter);
+            return static_cast<uint64_t>(counter.QuadPart);
+#else
+            // Not slewed by NTP, unlike CLOCK_MONOTONIC.
+            timespec time;
+            clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+            return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+#endif
+        }
+
+        uint64_t GetOsFrequency()
+        {
+#ifdef _WIN32
+            LARGE_INTEGER frequency;
+            QueryPerformanceFrequency(&frequency);
+            return static_cast<uint64_t>(frequency.QuadPart);
+#else
+            return 1000000000ull;
+#endif
+        }
+
+#ifdef ENGINE_CLOCK_TSC
+        uint64_t ReadTsc() { return __rdtsc(); }
+
+        bool HasInvariantTsc()
+        {
+            uint32_t registers[4]{};
+#ifdef _MSC_VER
+            __cpuid(reinterpret_cast<int*>(registers), 0x80000000);
+            if (registers[0] < 0x80000007) { return false; }
+            __cpuid(reinterpret_cast<int*>(registers), 0x80000007);
+#else
+            if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) { return false; }
+            __get_cpuid(0x80000007, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+            if (0 == (registers[3] & (1u << 8))) { return false; }
+
+#ifdef __linux__
+            // The kernel drops the TSC as its clocksource when it finds it unsynchronized between cores.
+            char clocksource[32]{};
+            FILE* file = fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+            if (!file) { return false; }
+            bool read = nullptr != fgets(clocksource, sizeof(clocksource), file);
+            fclose(file);
+            return read && 0 == strncmp(clocksource, "tsc", 3);
+#else
+            return true;
+#endif
+        }
+
+        /**
+         * TSC read halfway through an OS clock read, so the pair refers to the same instant. The tightest of a few
+         * tries is kept, an interrupt between the reads would otherwise skew the calibration.
+         */
+        void ReadPair(uint64_t& tsc, uint64_t& os)
+        {
+            uint64_t best = UINT64_MAX;
+            for (uint32_t attempt = 0; attempt < 16; attempt++)
+            {
+                auto before = ReadTsc();
+                auto osTicks = ReadOsTicks();
+                auto after = ReadTsc();
+                if (after - before < best)
+                {
+                    best = after - before;
+                    tsc = before + (after - before) / 2;
+                    os = osTicks;
+                }
+            }
+        }
+
+        ClockSource Calibrate()
+        {
+            ClockSource source{false, GetOsFrequency()};
+            if (!HasInvariantTsc()) { return source; }
+
+            uint64_t tscStart, osStart, tscEnd, osEnd;
+            ReadPair(tscStart, osStart);
+            const auto osTarget = osStart + source.Frequency * CalibrationMs / 1000;
+            do {
+                ReadPair(tscEnd, osEnd);
+            } while (osEnd < osTarget);
+
+            auto frequency = static_cast<double>(tscEnd - tscStart) * static_cast<double>(source.Frequency) /
+                             static_cast<double>(osEnd - osStart);
+            if (frequency < 1e6) { return source; }
+
+            source.UseTsc = true;
+            source.Frequency = static_cast<uint64_t>(frequency + 0.5);
+            return source;
+        }
+#else
+        ClockSource Calibrate() { return {false, GetOsFrequency()}; }
+#endif
+
+        const ClockSource& GetSource()
+        {
+            static const ClockSource source = Calibrate();
+            return source;
+        }
+    }// namespace
+
+    uint64_t Clock::Now()
+    {
+#ifdef ENGINE_CLOCK_TSC
+        if (GetSource().UseTsc) { return ReadTsc(); }
+#endif
+        return ReadOsTicks();
+    }
+
+    uint64_t Clock::GetFrequency() { return GetSource().Frequency; }
+
+    bool Clock::IsTscBacked() { return GetSource().UseTsc; }
+
+    double Clock::ToSeconds(uint64_t ticks)
+    {
+        // Whole and fractional seconds separately, a large tick count would lose precision in a single division.
+        const auto frequency = GetSource().Frequency;
+        return static_cast<double>(ticks / frequency) +
+               static_cast<double>(ticks % frequency) / static_cast<double>(frequency);
+    }
+
+    uint64_t Clock::ToNanos(uint64_t ticks)
+    {
+        const auto frequency = GetSource().Frequency;
+        return ticks / frequency * 1000000000ull + ticks % frequency * 1000000000ull / frequency;
+    }
+
+    uint64_t Clock::GetThreadCpuNanos()
+    {
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) { return 0; }
+        auto toNanos = [](const FILETIME& time) {
+            return (static_cast<uint64_t>(time.dwHighDateTime) << 32 | time.dwLowDateTime) * 100;
+        };
+        return toNanos(kernel) + toNanos(user);
+#else
+        timespec time;
+        if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time)) { return 0; }
+        return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+#endif
+    }
+}// namespace Engine
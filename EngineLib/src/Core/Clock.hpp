@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Clock class definition
+ */
+
+#include <cstdint>
+
+namespace Engine
+{
+    /**
+     * Engine time source, every timestamp in the engine is a 64-bit tick count from Now().
+     *
+     * Ticks come from rdtsc when the TSC is invariant (and, on Linux, the kernel trusts it as its clocksource),
+     * calibrated once against the OS monotonic clock on first use. Otherwise they come straight from
+     * CLOCK_MONOTONIC_RAW or QueryPerformanceCounter. Tick differences stay exact however long the engine runs,
+     * convert them to seconds only at the end.
+     */
+    class Clock
+    {
+    public:
+        static uint64_t Now();
+
+        /** Ticks per second. */
+        static uint64_t GetFrequency();
+
+        static bool IsTscBacked();
+
+        static double ToSeconds(uint64_t ticks);
+
+        static double ToMillis(uint64_t ticks) { return ToSeconds(ticks) * 1e3; }
+
+        static double ToMicros(uint64_t ticks) { return ToSeconds(ticks) * 1e6; }
+
+        static uint64_t ToNanos(uint64_t ticks);
+
+        /**
+         * CPU time the calling thread has used, in nanoseconds rather than ticks. Time spent blocked or waiting is
+         * not in it. Windows advances it once per scheduler tick, so short intervals read coarse there.
+         */
+        static uint64_t GetThreadCpuNanos();
+    };
+}// namespace Engine
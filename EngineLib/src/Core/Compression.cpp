@@ -0,0 +1,576 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Compression class implementation
+ */
+
+#include "Compression.hpp"
+#include "Hash.hpp"
+#include "Log.hpp"
+#include "ScratchStack.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+    namespace
+    {
+        // A match needs at least MinMatch bytes, none may start in the last MatchFindLimit bytes and the last
+        // LastLiterals bytes are always literals, which keeps the encoder's word reads inside the input.
+        constexpr uint32_t MinMatch = 4;
+        constexpr uint32_t LastLiterals = 5;
+        constexpr uint32_t MatchFindLimit = 12;
+        constexpr uint32_t MaxOffset = 65535;
+        constexpr uint32_t HashLog = 14;
+        constexpr uint32_t SkipTrigger = 6;
+        constexpr uint32_t WildCopySize = 16;
+
+        constexpr uint32_t MinBlockSize = 1024;
+        constexpr uint32_t MaxBlockSize = 64 * 1024 * 1024;
+        constexpr uint32_t StoredBlockFlag = 0x80000000u;
+
+        constexpr uint8_t BlockChecksumFlag = 1 << 0;
+        constexpr uint8_t ContentChecksumFlag = 1 << 1;
+
+        struct FrameBlock {
+            uint32_t Offset{};
+            uint32_t Size{};
+            bool Stored{};
+        };
+
+        inline uint32_t Read32(const uint8_t* data)
+        {
+            uint32_t value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t Read64(const uint8_t* data)
+        {
+            uint64_t value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        inline uint32_t HashSequence(uint32_t sequence) { return (sequence * 2654435761u) >> (32 - HashLog); }
+
+        inline uint32_t CountMatch(const uint8_t* data, uint32_t position, uint32_t reference, uint32_t limit)
+        {
+            uint32_t length = 0;
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                while (position + length + sizeof(uint64_t) <= limit)
+                {
+                    auto diff = Read64(data + position + length) ^ Read64(data + reference + length);
+                    if (diff) { return length + (std::countr_zero(diff) >> 3); }
+                    length += sizeof(uint64_t);
+                }
+            }
+            while (position + length < limit && data[position + length] == data[reference + length]) { length++; }
+            return length;
+        }
+
+        inline uint8_t* WriteLength(uint8_t* output, uint32_t length)
+        {
+            while (length >= 255)
+            {
+                *output++ = 255;
+                length -= 255;
+            }
+            *output++ = static_cast<uint8_t>(length);
+            return output;
+        }
+
+        inline bool ReadLength(const uint8_t* input, uint32_t size, uint32_t& position, uint32_t& length)
+        {
+            uint8_t byte;
+            do {
+                if (position >= size) { return false; }
+                byte = input[position++];
+                length += byte;
+            } while (255 == byte);
+            return true;
+        }
+
+        void EncodeBlock(BufferView block, const CompressionFrameSpec& spec, BinaryWriter& writer)
+        {
+            ScratchScope scratch;
+            auto capacity = block.GetSize() - 1;
+            auto* compressed = static_cast<uint8_t*>(ScratchStack::Get().Allocate(capacity, 1));
+            auto size = compressed ? Compression::CompressBlock(block, compressed, capacity) : 0;
+
+            BufferView stored = size ? BufferView{compressed, size} : block;
+            writer.Write<uint32_t>(stored.GetSize() | (size ? 0 : StoredBlockFlag));
+            writer.WriteBytes(stored);
+            if (spec.BlockChecksums) { writer.Write<uint32_t>(Compression::ComputeChecksum(stored)); }
+        }
+
+        uint8_t GetFrameFlags(const CompressionFrameSpec& spec)
+        {
+            return (spec.BlockChecksums ? BlockChecksumFlag : 0) | (spec.ContentChecksum ? ContentChecksumFlag : 0);
+        }
+
+        void WriteFrameHeader(BinaryWriter& writer, uint8_t flags, uint32_t blockSize, uint64_t contentSize)
+        {
+            writer.Write<uint32_t>(CompressionFrameHeader::Magic);
+            writer.Write<uint8_t>(CompressionFrameHeader::Version);
+            writer.Write<uint8_t>(flags);
+            writer.Write<uint16_t>(0);
+            writer.Write<uint32_t>(blockSize);
+            writer.Write<uint64_t>(contentSize);
+        }
+
+        uint32_t ClampBlockSize(uint32_t blockSize) { return std::clamp(blockSize, MinBlockSize, MaxBlockSize); }
+
+        /** Reads the block at offset and moves past it, the end marker gives a block of size 0. */
+        bool ReadFrameBlock(BufferView frame, uint8_t flags, uint32_t& offset, FrameBlock& block)
+        {
+            if (offset + sizeof(uint32_t) > frame.GetSize()) { return false; }
+            auto word = frame.Read<uint32_t>(offset);
+            offset += sizeof(uint32_t);
+
+            block.Offset = offset;
+            block.Size = word & ~StoredBlockFlag;
+            block.Stored = word & StoredBlockFlag;
+            if (0 == block.Size) { return true; }
+
+            auto checksumSize = flags & BlockChecksumFlag ? sizeof(uint32_t) : 0;
+            if (block.Size + checksumSize > frame.GetSize() - offset) { return false; }
+            offset += block.Size + checksumSize;
+
+            if (checksumSize)
+            {
+                auto checksum = frame.Read<uint32_t>(block.Offset + block.Size);
+                if (checksum != Compression::ComputeChecksum(frame.Slice(block.Offset, block.Size))) { return false; }
+            }
+            return true;
+        }
+
+        bool DecodeFrameBlock(BufferView frame, const FrameBlock& block, uint8_t* output, uint32_t expectedSize)
+        {
+            auto data = frame.Slice(block.Offset, block.Size);
+            if (block.Stored)
+            {
+                if (data.GetSize() != expectedSize) { return false; }
+                memcpy(output, data.Data(), expectedSize);
+                return true;
+            }
+
+            auto size = Compression::DecompressBlock(data, output, expectedSize);
+            return size && *size == expectedSize;
+        }
+    }// namespace
+
+    uint32_t Compression::GetMaxCompressedSize(uint32_t size) { return size + size / 255 + 16; }
+
+    uint32_t Compression::CompressBlock(BufferView input, uint8_t* output, uint32_t capacity)
+    {
+        const auto* data = input.Data();
+        const auto size = input.GetSize();
+        auto* op = output;
+        auto* const outputEnd = output + capacity;
+
+        auto emitSequence = [&](uint32_t anchor, uint32_t literalLength, uint32_t offset, uint32_t matchLength) {
+            // Token, literal length overflow, literals, then offset and match length overflow when there is a match.
+            if (literalLength + literalLength / 255 + 8 > static_cast<uint32_t>(outputEnd - op)) { return false; }
+            auto* token = op++;
+            *token = static_cast<uint8_t>(std::min(literalLength, 15u) << 4);
+            if (literalLength >= 15) { op = WriteLength(op, literalLength - 15); }
+            memcpy(op, data + anchor, literalLength);
+            op += literalLength;
+            if (0 == matchLength) { return true; }
+
+            auto matchCode = matchLength - MinMatch;
+            if (matchCode / 255 + 3 > static_cast<uint32_t>(outputEnd - op)) { return false; }
+            *op++ = static_cast<uint8_t>(offset);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            *token |= static_cast<uint8_t>(std::min(matchCode, 15u));
+            if (matchCode >= 15) { op = WriteLength(op, matchCode - 15); }
+            return true;
+        };
+
+        uint32_t anchor = 0;
+        if (size > MatchFindLimit)
+        {
+            ScratchScope scratch;
+            auto table = scratch.AllocateArray<uint32_t>(1u << HashLog);
+            if (table.empty()) { return 0; }
+
+            const uint32_t findLimit = size - MatchFindLimit;
+            const uint32_t matchLimit = size - LastLiterals;
+            uint32_t position = 1;
+            while (position < findLimit)
+            {
+                auto sequence = Read32(data + position);
+                auto& slot = table[HashSequence(sequence)];
+                uint32_t reference = slot;
+                slot = position;
+
+                if (position - reference > MaxOffset || Read32(data + reference) != sequence)
+                {
+                    // Step further the longer nothing matched, incompressible data is skipped quickly.
+                    position += 1 + ((position - anchor) >> SkipTrigger);
+                    continue;
+                }
+
+                while (position > anchor && reference > 0 && data[position - 1] == data[reference - 1])
+                {
+                    position--;
+                    reference--;
+                }
+                auto matchLength =
+                        MinMatch + CountMatch(data, position + MinMatch, reference + MinMatch, matchLimit);
+                if (!emitSequence(anchor, position - anchor, position - reference, matchLength)) { return 0; }
+
+                position += matchLength;
+                anchor = position;
+                if (position < findLimit) { table[HashSequence(Read32(data + position - 2))] = position - 2; }
+            }
+        }
+
+        if (!emitSequence(anchor, size - anchor, 0, 0)) { return 0; }
+        return static_cast<uint32_t>(op - output);
+    }
+
+    std::expected<uint32_t, ErrorStatus> Compression::DecompressBlock(BufferView input, uint8_t* output,
+                                                                      uint32_t capacity)
+    {
+        const auto* data = input.Data();
+        const auto size = input.GetSize();
+        uint32_t position = 0;
+        uint32_t written = 0;
+
+        while (true)
+        {
+            if (position >= size) { return std::unexpected(ErrorStatus::CorruptData); }
+            auto token = data[position++];
+
+            uint32_t literalLength = token >> 4;
+            if (15 == literalLength && !ReadLength(data, size, position, literalLength))
+            {
+                return std::unexpected(ErrorStatus::CorruptData);
+            }
+            if (literalLength > size - position || literalLength > capacity - written)
+            {
+                return std::unexpected(ErrorStatus::CorruptData);
+            }
+            // Short runs are copied as one fixed size chunk when there is room, the bytes past the run are
+            // overwritten by what follows.
+            if (literalLength <= WildCopySize && size - position >= WildCopySize && capacity - written >= WildCopySize)
+            {
+                memcpy(output + written, data + position, WildCopySize);
+            }
+            else { memcpy(output + written, data + position, literalLength); }
+            position += literalLength;
+            written += literalLength;
+
+            // The last sequence carries literals only.
+            if (position == size) { break; }
+
+            if (size - position < 2) { return std::unexpected(ErrorStatus::CorruptData); }
+            uint32_t offset = data[position] | (data[position + 1] << 8);
+            position += 2;
+            if (0 == offset || offset > written) { return std::unexpected(ErrorStatus::CorruptData); }
+
+            uint32_t matchLength = token & 15;
+            if (15 == matchLength && !ReadLength(data, size, position, matchLength))
+            {
+                return std::unexpected(ErrorStatus::CorruptData);
+            }
+            matchLength += MinMatch;
+            if (matchLength > capacity - written) { return std::unexpected(ErrorStatus::CorruptData); }
+
+            auto* destination = output + written;
+            const auto* source = destination - offset;
+            if (offset >= WildCopySize && matchLength <= WildCopySize && capacity - written >= WildCopySize)
+            {
+                memcpy(destination, source, WildCopySize);
+            }
+            else if (offset >= matchLength) { memcpy(destination, source, matchLength); }
+            else
+            {
+                // Overlapping copies repeat the last offset bytes, they have to go forward one byte at a time.
+                for (uint32_t i = 0; i < matchLength; i++) { destination[i] = source[i]; }
+            }
+            written += matchLength;
+        }
+
+        return written;
+    }
+
+    Buffer Compression::Compress(BufferView input, const CompressionFrameSpec& spec)
+    {
+        const auto blockSize = ClampBlockSize(spec.BlockSize);
+        const auto blockCount = static_cast<uint32_t>((uint64_t{input.GetSize()} + blockSize - 1) / blockSize);
+        const auto flags = GetFrameFlags(spec);
+
+        BinaryWriter writer(GetMaxCompressedSize(input.GetSize()) / 2 + CompressionFrameHeader::Size);
+        WriteFrameHeader(writer, flags, blockSize, input.GetSize());
+
+        auto threadCount = std::min(spec.ThreadCount, blockCount);
+        if (threadCount > 1)
+        {
+            std::vector<Buffer> blocks(blockCount);
+            std::atomic<uint32_t> next{};
+            auto worker = [&]() {
+                for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < blockCount;
+                     i = next.fetch_add(1, std::memory_order_relaxed))
+                {
+                    BinaryWriter blockWriter(blockSize / 2);
+                    EncodeBlock(input.Slice(i * blockSize, blockSize), spec, blockWriter);
+                    blocks[i] = blockWriter.Release();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount - 1);
+            for (uint32_t i = 1; i < threadCount; i++) { threads.emplace_back(worker); }
+            worker();
+            for (auto& thread: threads) { thread.join(); }
+
+            for (auto& block: blocks) { writer.WriteBytes(block); }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < blockCount; i++)
+            {
+                EncodeBlock(input.Slice(i * blockSize, blockSize), spec, writer);
+            }
+        }
+
+        writer.Write<uint32_t>(0);
+        if (flags & ContentChecksumFlag)
+        {
+            uint32_t checksum = 0;
+            for (uint32_t i = 0; i < blockCount; i++)
+            {
+                checksum = ComputeChecksum(input.Slice(i * blockSize, blockSize), checksum);
+            }
+            writer.Write<uint32_t>(checksum);
+        }
+
+        return writer.Release();
+    }
+
+    std::expected<Buffer, ErrorStatus> Compression::Decompress(BufferView frame, uint32_t threadCount)
+    {
+        auto header = ReadFrameHeader(frame);
+        if (!header) { return std::unexpected(header.error()); }
+
+        const auto blockSize = header->BlockSize;
+        const auto contentSize = static_cast<uint32_t>(header->ContentSize);
+        const auto blockCount = static_cast<uint32_t>((uint64_t{contentSize} + blockSize - 1) / blockSize);
+
+        // Every block costs at least its header word, which bounds the count before anything is allocated.
+        if (blockCount > frame.GetSize() / sizeof(uint32_t))
+        {
+            LOG_ERROR("Compressed frame is corrupt\n");
+            return std::unexpected(ErrorStatus::CorruptData);
+        }
+
+        ScratchScope scratch;
+        auto blocks = scratch.AllocateArray<FrameBlock>(blockCount + 1);
+        uint32_t offset = CompressionFrameHeader::Size;
+        for (uint32_t i = 0; i <= blockCount; i++)
+        {
+            bool valid = ReadFrameBlock(frame, header->Flags, offset, blocks[i]);
+            bool isEnd = 0 == blocks[i].Size;
+            if (!valid || isEnd != (i == blockCount))
+            {
+                LOG_ERROR("Compressed frame is corrupt\n");
+                return std::unexpected(ErrorStatus::CorruptData);
+            }
+        }
+
+        Buffer output;
+        if (contentSize > 0) { output.Allocate(contentSize); }
+
+        std::atomic<uint32_t> next{};
+        std::atomic<bool> failed{};
+        auto worker = [&]() {
+            for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < blockCount;
+                 i = next.fetch_add(1, std::memory_order_relaxed))
+            {
+                auto expectedSize = std::min(blockSize, contentSize - i * blockSize);
+                if (!DecodeFrameBlock(frame, blocks[i], output.Data + i * blockSize, expectedSize))
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        threadCount = std::min(threadCount, blockCount);
+        std::vector<std::thread> threads;
+        if (threadCount > 1) { threads.reserve(threadCount - 1); }
+        for (uint32_t i = 1; i < threadCount; i++) { threads.emplace_back(worker); }
+        worker();
+        for (auto& thread: threads) { thread.join(); }
+
+        if (failed.load(std::memory_order_relaxed))
+        {
+            LOG_ERROR("Compressed frame is corrupt\n");
+            return std::unexpected(ErrorStatus::CorruptData);
+        }
+
+        if (header->Flags & ContentChecksumFlag)
+        {
+            uint32_t checksum = 0;
+            for (uint32_t i = 0; i < blockCount; i++)
+            {
+                checksum = ComputeChecksum(output.GetView().Slice(i * blockSize, blockSize), checksum);
+            }
+            if (offset + sizeof(uint32_t) > frame.GetSize() || frame.Read<uint32_t>(offset) != checksum)
+            {
+                LOG_ERROR("Compressed frame checksum mismatch\n");
+                return std::unexpected(ErrorStatus::CorruptData);
+            }
+        }
+
+        return output;
+    }
+
+    std::expected<CompressionFrameHeader, ErrorStatus> Compression::ReadFrameHeader(BufferView frame)
+    {
+        if (frame.GetSize() < CompressionFrameHeader::Size || frame.Read<uint32_t>(0) != CompressionFrameHeader::Magic ||
+            frame.Read<uint8_t>(4) != CompressionFrameHeader::Version)
+        {
+            return std::unexpected(ErrorStatus::Invalid);
+        }
+
+        CompressionFrameHeader header;
+        header.Flags = frame.Read<uint8_t>(5);
+        header.BlockSize = frame.Read<uint32_t>(8);
+        header.ContentSize = frame.Read<uint64_t>(12);
+        if (header.BlockSize != ClampBlockSize(header.BlockSize) || header.ContentSize > UINT32_MAX)
+        {
+            return std::unexpected(ErrorStatus::Invalid);
+        }
+        return header;
+    }
+
+    uint32_t Compression::ComputeChecksum(BufferView data, uint32_t seed)
+    {
+        auto hash = Hash::Compute(data, seed);
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+}// namespace Engine
+
+namespace Engine
+{
+    FrameCompressor::FrameCompressor(const CompressionFrameSpec& spec) : m_Spec(spec)
+    {
+        m_Spec.BlockSize = ClampBlockSize(m_Spec.BlockSize);
+        m_Pending.Allocate(m_Spec.BlockSize);
+        Begin();
+    }
+
+    void FrameCompressor::Write(BufferView input)
+    {
+        while (!input.Empty())
+        {
+            auto size = std::min(input.GetSize(), m_Spec.BlockSize - m_PendingSize);
+            memcpy(m_Pending.Data + m_PendingSize, input.Data(), size);
+            m_PendingSize += size;
+            input = input.Slice(size);
+            if (m_PendingSize == m_Spec.BlockSize) { FlushBlock(); }
+        }
+    }
+
+    Buffer FrameCompressor::Finish()
+    {
+        if (m_PendingSize > 0) { FlushBlock(); }
+        m_Writer.Write<uint32_t>(0);
+        if (m_Spec.ContentChecksum) { m_Writer.Write<uint32_t>(m_ContentChecksum); }
+
+        // The content size is only known now, patch it into the header written by Begin().
+        auto frame = m_Writer.Release();
+        memcpy(frame.Data + 12, &m_ContentSize, sizeof(m_ContentSize));
+
+        Begin();
+        return frame;
+    }
+
+    void FrameCompressor::Begin()
+    {
+        m_PendingSize = 0;
+        m_ContentSize = 0;
+        m_ContentChecksum = 0;
+        WriteFrameHeader(m_Writer, GetFrameFlags(m_Spec), m_Spec.BlockSize, 0);
+    }
+
+    void FrameCompressor::FlushBlock()
+    {
+        BufferView block{m_Pending.Data, m_PendingSize};
+        EncodeBlock(block, m_Spec, m_Writer);
+        if (m_Spec.ContentChecksum) { m_ContentChecksum = Compression::ComputeChecksum(block, m_ContentChecksum); }
+        m_ContentSize += m_PendingSize;
+        m_PendingSize = 0;
+    }
+
+    FrameDecompressor::FrameDecompressor(BufferView frame) : m_Frame(frame)
+    {
+        auto header = Compression::ReadFrameHeader(frame);
+        if (!header)
+        {
+            m_Failed = true;
+            m_Error = header.error();
+            return;
+        }
+
+        m_Header = *header;
+        m_Offset = CompressionFrameHeader::Size;
+        m_Block.Allocate(m_Header.BlockSize);
+    }
+
+    std::expected<BufferView, ErrorStatus> FrameDecompressor::NextBlock()
+    {
+        if (m_Failed) { return std::unexpected(m_Error); }
+        if (m_Finished) { return BufferView{}; }
+
+        auto fail = [this]() {
+            m_Failed = true;
+            m_Error = ErrorStatus::CorruptData;
+            return std::unexpected(m_Error);
+        };
+
+        FrameBlock block;
+        if (!ReadFrameBlock(m_Frame, m_Header.Flags, m_Offset, block)) { return fail(); }
+
+        auto remaining = m_Header.ContentSize - m_DecodedSize;
+        if (0 == block.Size)
+        {
+            if (remaining > 0) { return fail(); }
+            if (m_Header.Flags & ContentChecksumFlag)
+            {
+                if (m_Offset + sizeof(uint32_t) > m_Frame.GetSize() ||
+                    m_Frame.Read<uint32_t>(m_Offset) != m_ContentChecksum)
+                {
+                    return fail();
+                }
+            }
+            m_Finished = true;
+            return BufferView{};
+        }
+
+        auto expectedSize = static_cast<uint32_t>(std::min<uint64_t>(m_Header.BlockSize, remaining));
+        if (0 == expectedSize || !DecodeFrameBlock(m_Frame, block, m_Block.Data, expectedSize)) { return fail(); }
+
+        BufferView decoded{m_Block.Data, expectedSize};
+        if (m_Header.Flags & ContentChecksumFlag)
+        {
+            m_ContentChecksum = Compression::ComputeChecksum(decoded, m_ContentChecksum);
+        }
+        m_DecodedSize += expectedSize;
+        return decoded;
+    }
+}// namespace Engine
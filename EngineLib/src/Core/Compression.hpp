@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Compression class definition
+ */
+
+#include <cstdint>
+#include <expected>
+
+#include <Core/BinaryWriter.hpp>
+#include <Core/Buffer.hpp>
+#include <Core/BufferView.hpp>
+#include <Core/Error.hpp>
+
+namespace Engine
+{
+    struct CompressionFrameSpec {
+        uint32_t BlockSize = 256 * 1024;
+        /** Checksum of every stored block, catches corruption before decoding it. */
+        bool BlockChecksums = false;
+        /** Checksum of the whole decompressed content. */
+        bool ContentChecksum = true;
+        /** Blocks are independent, more than one thread compresses them in parallel. */
+        uint32_t ThreadCount = 1;
+    };
+
+    struct CompressionFrameHeader {
+        static constexpr uint32_t Magic = 0x345A4C45;// "ELZ4"
+        /** 2 since checksums are the folded Hash instead of XXH32, version 1 frames are rejected as invalid. */
+        static constexpr uint8_t Version = 2;
+        static constexpr uint32_t Size = 20;
+
+        uint8_t Flags{};
+        uint32_t BlockSize{};
+        uint64_t ContentSize{};
+    };
+
+    /**
+     * LZ77 block codec in the LZ4 mould: greedy hash matching over a 64 KiB window, byte aligned sequences of
+     * literals and matches and no entropy stage, so both directions run at memory speed. The decoder checks every
+     * length and offset, corrupt input fails instead of reading or writing out of bounds.
+     *
+     * Frames split the input into independently compressed blocks with optional checksums. Blocks that do not
+     * shrink are stored as they are.
+     */
+    class Compression
+    {
+    public:
+        static uint32_t GetMaxCompressedSize(uint32_t size);
+
+        /** Returns the compressed size, 0 when the output does not fit into capacity. */
+        static uint32_t CompressBlock(BufferView input, uint8_t* output, uint32_t capacity);
+
+        /** Returns the decompressed size. */
+        static std::expected<uint32_t, ErrorStatus> DecompressBlock(BufferView input, uint8_t* output,
+                                                                    uint32_t capacity);
+
+        static Buffer Compress(BufferView input, const CompressionFrameSpec& spec = {});
+
+        static std::expected<Buffer, ErrorStatus> Decompress(BufferView frame, uint32_t threadCount = 1);
+
+        static std::expected<CompressionFrameHeader, ErrorStatus> ReadFrameHeader(BufferView frame);
+
+        /** Hash folded to 32 bits, changing it changes the frame format and needs a new header Version. */
+        static uint32_t ComputeChecksum(BufferView data, uint32_t seed = 0);
+    };
+
+    /**
+     * Builds a frame from input that arrives in pieces, a block is compressed whenever a full one is buffered.
+     */
+    class FrameCompressor
+    {
+    public:
+        explicit FrameCompressor(const CompressionFrameSpec& spec = {});
+        ~FrameCompressor() = default;
+
+    public:
+        void Write(BufferView input);
+
+        /** Flushes the last partial block and returns the frame, the compressor starts a new frame afterwards. */
+        Buffer Finish();
+
+    private:
+        void Begin();
+
+        void FlushBlock();
+
+    private:
+        CompressionFrameSpec m_Spec;
+        BinaryWriter m_Writer;
+        Buffer m_Pending;
+        uint32_t m_PendingSize{};
+        uint64_t m_ContentSize{};
+        uint32_t m_ContentChecksum{};
+    };
+
+    /**
+     * Decodes a frame one block at a time, so the whole content never has to be in memory at once.
+     */
+    class FrameDecompressor
+    {
+    public:
+        explicit FrameDecompressor(BufferView frame);
+        ~FrameDecompressor() = default;
+
+    public:
+        /** The next decompressed block, valid until the next call. An empty view marks the end of the frame. */
+        std::expected<BufferView, ErrorStatus> NextBlock();
+
+        const CompressionFrameHeader& GetHeader() const { return m_Header; }
+
+    private:
+        BufferView m_Frame;
+        CompressionFrameHeader m_Header;
+        Buffer m_Block;
+        uint32_t m_Offset{};
+        uint64_t m_DecodedSize{};
+        uint32_t m_ContentChecksum{};
+        bool m_Finished{};
+        ErrorStatus m_Error{};
+        bool m_Failed{};
+    };
+}// namespace Engine
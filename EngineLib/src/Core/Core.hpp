@@ -4,6 +4,7 @@
 #include <Core/Ref.hpp>
 #include <Core/Error.hpp>
 #include <Core/Allocator.hpp>
+#include <Core/Clock.hpp>
 #include <Core/Timer.hpp>
 #include <Core/Timestep.hpp>
 #include <Core/Result.hpp>
\ No newline at end of file
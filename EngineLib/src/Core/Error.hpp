@@ -12,6 +12,9 @@ namespace Engine
         Fail,
         Invalid,
         StringLengthIsZero,
-        CanNotCompileShader
+        CanNotCompileShader,
+        CanNotOpenFile,
+        CanNotMapFile,
+        CorruptData
     };
 }// namespace Engine
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * FrameArena class implementation
+ */
+
+#include "FrameArena.hpp"
+#include <Core/Allocator.hpp>
+#include <Core/Log.hpp>
+
+#include <algorithm>
+
+namespace Engine
+{
+    FrameArena::~FrameArena() { Destroy(); }
+
+    void FrameArena::Init(size_t frameCapacity, uint32_t framesInFlight)
+    {
+        Destroy();
+
+        m_FramesInFlight = std::clamp(framesInFlight, 1u, MaxFramesInFlight);
+        for (uint32_t index = 0; index < m_FramesInFlight; index++)
+        {
+            auto& frame = m_Frames[index];
+            frame.Main.Data = Allocator::AllocateArray<uint8_t>(frameCapacity, MemoryTag::Transient);
+            frame.Main.Capacity = frameCapacity;
+        }
+    }
+
+    void FrameArena::Destroy()
+    {
+        for (auto& frame: m_Frames)
+        {
+            for (auto& block: frame.Overflow) { ReleaseBlock(block); }
+            frame.Overflow.clear();
+            ReleaseBlock(frame.Main);
+            frame.Used = 0;
+        }
+        m_FramesInFlight = 0;
+        m_CurrentFrame = 0;
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        if (0 == m_FramesInFlight) { Init(); }
+
+        auto& frame = m_Frames[m_CurrentFrame];
+        void* ptr = frame.Overflow.empty() ? AllocateFromBlock(frame.Main, size, alignment)
+                                           : AllocateFromBlock(frame.Overflow.back(), size, alignment);
+
+        if (nullptr == ptr)
+        {
+            Block block;
+            block.Capacity = std::max(frame.Main.Capacity, size + alignment);
+            block.Data = Allocator::AllocateArray<uint8_t>(block.Capacity, MemoryTag::Transient);
+            frame.Overflow.push_back(block);
+
+            ptr = AllocateFromBlock(frame.Overflow.back(), size, alignment);
+            LOG_RATE_LIMITED(Memory, Memory, 4, "Frame arena overflow, added %zuB block\n", block.Capacity);
+        }
+
+        frame.Used += size;
+        m_Peak = std::max(m_Peak, frame.Used);
+        return ptr;
+    }
+
+    void FrameArena::NextFrame()
+    {
+        if (0 == m_FramesInFlight) { return; }
+
+        m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
+        m_FrameNumber++;
+        ResetFrame(m_Frames[m_CurrentFrame]);
+    }
+
+    size_t FrameArena::GetUsed() const { return m_FramesInFlight ? m_Frames[m_CurrentFrame].Used : 0; }
+
+    size_t FrameArena::GetCapacity() const { return m_FramesInFlight ? m_Frames[m_CurrentFrame].Main.Capacity : 0; }
+
+    size_t FrameArena::GetPeak() const { return m_Peak; }
+
+    uint64_t FrameArena::GetFrameNumber() const { return m_FrameNumber; }
+
+    void* FrameArena::AllocateFromBlock(Block& block, size_t size, size_t alignment)
+    {
+        auto base = reinterpret_cast<uintptr_t>(block.Data);
+        auto aligned = (base + block.Offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        auto end = aligned - base + size;
+        if (nullptr == block.Data || end > block.Capacity) { return nullptr; }
+
+        block.Offset = end;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void FrameArena::ReleaseBlock(Block& block)
+    {
+        if (block.Data) { Allocator::DeallocateArray(block.Data); }
+        block = Block{};
+    }
+
+    void FrameArena::ResetFrame(Frame& frame)
+    {
+        if (!frame.Overflow.empty())
+        {
+            // Grow once to fit everything the frame needed, instead of spilling again every frame.
+            size_t capacity = frame.Main.Capacity;
+            for (auto& block: frame.Overflow)
+            {
+                capacity += block.Offset;
+                ReleaseBlock(block);
+            }
+            frame.Overflow.clear();
+
+            ReleaseBlock(frame.Main);
+            frame.Main.Data = Allocator::AllocateArray<uint8_t>(capacity, MemoryTag::Transient);
+            frame.Main.Capacity = capacity;
+        }
+
+        frame.Main.Offset = 0;
+        frame.Used = 0;
+    }
+}// namespace Engine
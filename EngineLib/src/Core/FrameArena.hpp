@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * FrameArena class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Engine
+{
+    /**
+     * Bump pointer allocator for data that only lives for a frame or two.
+     *
+     * Every frame in flight owns its own block. NextFrame() moves to the next block and rewinds it, so memory handed
+     * out during frame N stays valid until frame N + framesInFlight begins. Running out of space spills into
+     * overflow blocks; the next time that frame is reset the block grows to cover the spill, so a steady state loop
+     * stops touching the heap after a few frames.
+     *
+     * Not thread safe, owned and reset by the main loop.
+     */
+    class FrameArena
+    {
+    public:
+        static constexpr uint32_t MaxFramesInFlight = 3;
+        static constexpr size_t DefaultCapacity = 1024 * 1024;
+
+    public:
+        FrameArena() = default;
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+    public:
+        void Init(size_t frameCapacity = DefaultCapacity, uint32_t framesInFlight = 2);
+
+        void Destroy();
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template <typename T>
+        T* AllocateArray(size_t count);
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args);
+
+        void NextFrame();
+
+    public:
+        size_t GetUsed() const;
+
+        size_t GetCapacity() const;
+
+        size_t GetPeak() const;
+
+        uint64_t GetFrameNumber() const;
+
+    private:
+        struct Block {
+            uint8_t* Data{};
+            size_t Capacity{};
+            size_t Offset{};
+        };
+
+        struct Frame {
+            Block Main;
+            std::vector<Block> Overflow;
+            size_t Used{};
+        };
+
+    private:
+        static void* AllocateFromBlock(Block& block, size_t size, size_t alignment);
+
+        static void ReleaseBlock(Block& block);
+
+        void ResetFrame(Frame& frame);
+
+    private:
+        Frame m_Frames[MaxFramesInFlight]{};
+        uint32_t m_FramesInFlight{};
+        uint32_t m_CurrentFrame{};
+        uint64_t m_FrameNumber{};
+        size_t m_Peak{};
+    };
+
+    /**
+     * Standard library allocator adapter, e.g. std::vector<int, FrameAllocator<int>> values(FrameAllocator<int>(arena)).
+     * Deallocation is a no-op, memory comes back when the arena frame is reset.
+     */
+    template <typename T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+
+    public:
+        FrameAllocator(FrameArena& arena) noexcept : m_Arena(&arena) {}
+
+        template <typename T2>
+        FrameAllocator(const FrameAllocator<T2>& other) noexcept : m_Arena(other.GetArena())
+        {
+        }
+
+    public:
+        T* allocate(size_t count) { return m_Arena->AllocateArray<T>(count); }
+
+        void deallocate(T*, size_t) noexcept {}
+
+        FrameArena* GetArena() const { return m_Arena; }
+
+        template <typename T2>
+        bool operator==(const FrameAllocator<T2>& other) const
+        {
+            return m_Arena == other.GetArena();
+        }
+
+    private:
+        FrameArena* m_Arena;
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}// namespace Engine
+
+#include "FrameArena.impl.hpp"
@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * FrameArena templated functions implementation
+ */
+
+#include <new>
+#include <utility>
+#include "FrameArena.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    T* FrameArena::AllocateArray(size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T, typename... Args>
+    T* FrameArena::Create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destructed!");
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+}// namespace Engine
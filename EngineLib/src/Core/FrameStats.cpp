@@ -0,0 +1,271 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * FrameStats class implementation
+ */
+
+#include "FrameStats.hpp"
+#include <Core/Clock.hpp>
+#include <Core/Log.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr double Percentiles[] = {50.0, 95.0, 99.0, 99.9};
+
+        FrameStatsSpec s_Spec{};
+        FrameTimeSeries s_FrameTimes;
+        FrameTimeSeries s_CpuTimes;
+        std::vector<LayerFrameStats> s_Layers;
+        std::vector<LayerFrameTime> s_CurrentLayers;
+        FrameTimes s_LastFrame{};
+        uint64_t s_HitchCount{};
+
+        uint64_t s_FrameNumber{};
+        uint64_t s_FrameBegin{};
+        uint64_t s_FrameCpuBegin{};
+        uint64_t s_PreviousFrameEnd{};
+        bool s_HasPreviousFrame{};
+        StringId s_CurrentLayer;
+        uint64_t s_LayerBegin{};
+
+        std::string GetLayerName(StringId layer)
+        {
+            auto name = layer.GetString();
+            if (!name.empty()) { return std::string(name); }
+
+            char text[24];
+            snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(layer.GetValue()));
+            return text;
+        }
+
+        void DefaultHitchCallback(const FrameTimes& frame, double thresholdMs)
+        {
+            auto slowest = std::max_element(frame.Layers.begin(), frame.Layers.end(),
+                                            [](const auto& a, const auto& b) { return a.Ms < b.Ms; });
+            if (frame.Layers.end() == slowest)
+            {
+                LOG_RATE_LIMITED(General, Warning, 4, "Frame %llu hitched: %.2fms over the %.2fms threshold\n",
+                                 static_cast<unsigned long long>(frame.FrameNumber), frame.FrameMs, thresholdMs);
+                return;
+            }
+
+            LOG_RATE_LIMITED(General, Warning, 4,
+                             "Frame %llu hitched: %.2fms over the %.2fms threshold, layer %s took %.2fms\n",
+                             static_cast<unsigned long long>(frame.FrameNumber), frame.FrameMs, thresholdMs,
+                             GetLayerName(slowest->Layer), slowest->Ms);
+        }
+
+        FILE* OpenSummary(const std::filesystem::path& path)
+        {
+            FILE* file = fopen(path.string().c_str(), "w");
+            if (!file) { LOG_ERROR("Can Not Open %s!\n", path.string().c_str()); }
+            return file;
+        }
+
+        void WriteCsvRow(FILE* file, const std::string& name, const FrameTimeSeries& series)
+        {
+            const auto& histogram = series.GetHistogram();
+            fprintf(file, "%s,%llu,%.4f,%.4f,%.4f", name.c_str(), static_cast<unsigned long long>(histogram.GetCount()),
+                    histogram.GetMean() / 1e6, histogram.GetMin() / 1e6, histogram.GetMax() / 1e6);
+            for (auto percentile: Percentiles) { fprintf(file, ",%.4f", series.GetPercentile(percentile)); }
+            fputc('\n', file);
+        }
+
+        void WriteJsonSeries(FILE* file, const std::string& name, const FrameTimeSeries& series, bool last)
+        {
+            std::string escaped;
+            for (char c: name)
+            {
+                if ('"' == c || '\\' == c) { escaped.push_back('\\'); }
+                escaped.push_back(c);
+            }
+
+            const auto& histogram = series.GetHistogram();
+            fprintf(file, "    {\"name\": \"%s\", \"count\": %llu, \"meanMs\": %.4f, \"minMs\": %.4f, \"maxMs\": %.4f",
+                    escaped.c_str(), static_cast<unsigned long long>(histogram.GetCount()), histogram.GetMean() / 1e6,
+                    histogram.GetMin() / 1e6, histogram.GetMax() / 1e6);
+            fprintf(file, ", \"p50Ms\": %.4f, \"p95Ms\": %.4f, \"p99Ms\": %.4f, \"p999Ms\": %.4f}%s\n",
+                    series.GetPercentile(50.0), series.GetPercentile(95.0), series.GetPercentile(99.0),
+                    series.GetPercentile(99.9), last ? "" : ",");
+        }
+    }// namespace
+
+    void FrameTimeSeries::Init(uint32_t windowFrames)
+    {
+        m_Window.assign(std::max<uint32_t>(windowFrames, 1), 0.0);
+        Reset();
+    }
+
+    void FrameTimeSeries::Record(double ms)
+    {
+        if (m_Window.empty()) { Init(FrameStatsSpec{}.WindowFrames); }
+
+        if (m_Size == m_Window.size()) { m_Sum -= m_Window[m_Next]; }
+        else { m_Size++; }
+        m_Window[m_Next] = ms;
+        m_Sum += ms;
+        m_Next = (m_Next + 1) % m_Window.size();
+
+        m_Histogram.Record(static_cast<uint64_t>(std::max(ms, 0.0) * 1e6));
+    }
+
+    void FrameTimeSeries::Reset()
+    {
+        m_Next = 0;
+        m_Size = 0;
+        m_Sum = 0.0;
+        m_Histogram.Reset();
+    }
+
+    double FrameTimeSeries::GetMean() const { return m_Size ? m_Sum / m_Size : 0.0; }
+
+    double FrameTimeSeries::GetMin() const
+    {
+        if (0 == m_Size) { return 0.0; }
+        return *std::min_element(m_Window.begin(), m_Window.begin() + m_Size);
+    }
+
+    double FrameTimeSeries::GetMax() const
+    {
+        if (0 == m_Size) { return 0.0; }
+        return *std::max_element(m_Window.begin(), m_Window.begin() + m_Size);
+    }
+
+    double FrameTimeSeries::GetPercentile(double percentile) const
+    {
+        return m_Histogram.GetValueAtPercentile(percentile) / 1e6;
+    }
+
+    void FrameStats::Init(const FrameStatsSpec& spec)
+    {
+        s_Spec = spec;
+        if (!s_Spec.HitchCallback) { s_Spec.HitchCallback = DefaultHitchCallback; }
+
+        s_FrameTimes.Init(spec.WindowFrames);
+        s_CpuTimes.Init(spec.WindowFrames);
+        s_Layers.clear();
+        s_CurrentLayers.clear();
+        s_LastFrame = {};
+        s_HitchCount = 0;
+        s_HasPreviousFrame = false;
+    }
+
+    void FrameStats::Shutdown()
+    {
+        if (!s_Spec.CsvPath.empty()) { WriteCsv(s_Spec.CsvPath); }
+        if (!s_Spec.JsonPath.empty()) { WriteJson(s_Spec.JsonPath); }
+    }
+
+    void FrameStats::BeginFrame(uint64_t frameNumber, uint64_t frameStart)
+    {
+        s_FrameNumber = frameNumber;
+        s_CurrentLayers.clear();
+        s_FrameBegin = frameStart;
+        s_FrameCpuBegin = Clock::GetThreadCpuNanos();
+    }
+
+    void FrameStats::EndFrame()
+    {
+        auto now = Clock::Now();
+
+        s_LastFrame.FrameNumber = s_FrameNumber;
+        s_LastFrame.CpuMs = static_cast<double>(Clock::GetThreadCpuNanos() - s_FrameCpuBegin) / 1e6;
+        s_LastFrame.FrameMs = Clock::ToMillis(now - (s_HasPreviousFrame ? s_PreviousFrameEnd : s_FrameBegin));
+        // Copy assignment reuses the capacity of the previous frames, this does not allocate once the layers are known.
+        s_LastFrame.Layers = s_CurrentLayers;
+        s_PreviousFrameEnd = now;
+        s_HasPreviousFrame = true;
+
+        s_FrameTimes.Record(s_LastFrame.FrameMs);
+        s_CpuTimes.Record(s_LastFrame.CpuMs);
+
+        if (s_Spec.HitchThresholdMs > 0.0 && s_LastFrame.FrameMs > s_Spec.HitchThresholdMs)
+        {
+            s_HitchCount++;
+            s_Spec.HitchCallback(s_LastFrame, s_Spec.HitchThresholdMs);
+        }
+    }
+
+    void FrameStats::BeginLayer(StringId layer)
+    {
+        s_CurrentLayer = layer;
+        s_LayerBegin = Clock::Now();
+    }
+
+    void FrameStats::EndLayer()
+    {
+        auto ms = Clock::ToMillis(Clock::Now() - s_LayerBegin);
+        s_CurrentLayers.push_back({s_CurrentLayer, ms});
+
+        auto stats = std::find_if(s_Layers.begin(), s_Layers.end(),
+                                  [](const LayerFrameStats& entry) { return entry.Layer == s_CurrentLayer; });
+        if (s_Layers.end() == stats)
+        {
+            stats = s_Layers.emplace(s_Layers.end(), LayerFrameStats{s_CurrentLayer, {}});
+            stats->Times.Init(s_Spec.WindowFrames);
+        }
+        stats->Times.Record(ms);
+    }
+
+    const FrameTimes& FrameStats::GetLastFrame() { return s_LastFrame; }
+
+    const FrameTimeSeries& FrameStats::GetFrameTimes() { return s_FrameTimes; }
+
+    const FrameTimeSeries& FrameStats::GetCpuTimes() { return s_CpuTimes; }
+
+    const FrameTimeSeries* FrameStats::GetLayerTimes(StringId layer)
+    {
+        for (auto& stats: s_Layers)
+        {
+            if (stats.Layer == layer) { return &stats.Times; }
+        }
+        return nullptr;
+    }
+
+    std::span<const LayerFrameStats> FrameStats::GetLayers() { return s_Layers; }
+
+    uint64_t FrameStats::GetHitchCount() { return s_HitchCount; }
+
+    std::expected<void, ErrorStatus> FrameStats::WriteCsv(const std::filesystem::path& path)
+    {
+        FILE* file = OpenSummary(path);
+        if (!file) { return std::unexpected(ErrorStatus::CanNotOpenFile); }
+
+        fprintf(file, "series,frames,mean_ms,min_ms,max_ms,p50_ms,p95_ms,p99_ms,p99.9_ms\n");
+        WriteCsvRow(file, "frame", s_FrameTimes);
+        WriteCsvRow(file, "cpu", s_CpuTimes);
+        for (auto& stats: s_Layers) { WriteCsvRow(file, "layer:" + GetLayerName(stats.Layer), stats.Times); }
+        fclose(file);
+        return {};
+    }
+
+    std::expected<void, ErrorStatus> FrameStats::WriteJson(const std::filesystem::path& path)
+    {
+        FILE* file = OpenSummary(path);
+        if (!file) { return std::unexpected(ErrorStatus::CanNotOpenFile); }
+
+        fprintf(file, "{\n  \"hitchThresholdMs\": %.4f,\n  \"hitches\": %llu,\n  \"series\": [\n",
+                s_Spec.HitchThresholdMs, static_cast<unsigned long long>(s_HitchCount));
+        WriteJsonSeries(file, "frame", s_FrameTimes, false);
+        WriteJsonSeries(file, "cpu", s_CpuTimes, s_Layers.empty());
+        for (size_t index = 0; index < s_Layers.size(); index++)
+        {
+            WriteJsonSeries(file, "layer:" + GetLayerName(s_Layers[index].Layer), s_Layers[index].Times,
+                            index + 1 == s_Layers.size());
+        }
+        fprintf(file, "  ]\n}\n");
+        fclose(file);
+        return {};
+    }
+}// namespace Engine
@@ -0,0 +1,144 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * FrameStats class definition
+ */
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <Core/Error.hpp>
+#include <Core/Histogram.hpp>
+#include <Core/StringId.hpp>
+
+namespace Engine
+{
+    struct LayerFrameTime {
+        StringId Layer;
+        double Ms{};
+    };
+
+    struct FrameTimes {
+        uint64_t FrameNumber{};
+        /** From the end of the previous frame to the end of this one. */
+        double FrameMs{};
+        /** CPU time the main thread used from BeginFrame() to EndFrame(), waits on vsync or the GPU are left out. */
+        double CpuMs{};
+        /** A copy of this frame's layer times, it stays valid after later frames start. */
+        std::vector<LayerFrameTime> Layers;
+    };
+
+    using FrameHitchCallback = void (*)(const FrameTimes& frame, double thresholdMs);
+
+    struct FrameStatsSpec {
+        /** Frames covered by the rolling mean, min and max. */
+        uint32_t WindowFrames = 240;
+        /** A frame longer than this is a hitch, 0 disables hitch detection. */
+        double HitchThresholdMs = 50.0;
+        /** Called on every hitch, the default logs the frame and its slowest layer. */
+        FrameHitchCallback HitchCallback{};
+        /** Summaries written on Shutdown() when set. */
+        std::filesystem::path CsvPath;
+        std::filesystem::path JsonPath;
+    };
+
+    /**
+     * Times of one quantity per frame: mean, min and max over the last WindowFrames frames and percentiles over the
+     * whole run from a Histogram.
+     */
+    class FrameTimeSeries
+    {
+    public:
+        void Init(uint32_t windowFrames);
+
+        void Record(double ms);
+
+        void Reset();
+
+    public:
+        double GetMean() const;
+
+        double GetMin() const;
+
+        double GetMax() const;
+
+        /** Over the whole run, percentile is 0 to 100. */
+        double GetPercentile(double percentile) const;
+
+        const Histogram& GetHistogram() const { return m_Histogram; }
+
+    private:
+        std::vector<double> m_Window;
+        uint32_t m_Next{};
+        uint32_t m_Size{};
+        double m_Sum{};
+        Histogram m_Histogram;
+    };
+
+    struct LayerFrameStats {
+        StringId Layer;
+        FrameTimeSeries Times;
+    };
+
+    /**
+     * Frame time statistics of Application::Run: the whole frame, the main thread's CPU time in it and every layer's
+     * OnUpdate. Frames over the hitch threshold go to the hitch callback. Everything is recorded and read on the main
+     * thread.
+     */
+    class FrameStats
+    {
+    public:
+        static void Init(const FrameStatsSpec& spec = {});
+
+        /** Writes the CSV and JSON summaries that are configured. */
+        static void Shutdown();
+
+        /** frameStart is the frame's Clock::Now() snapshot. */
+        static void BeginFrame(uint64_t frameNumber, uint64_t frameStart);
+
+        static void EndFrame();
+
+        static void BeginLayer(StringId layer);
+
+        static void EndLayer();
+
+    public:
+        static const FrameTimes& GetLastFrame();
+
+        static const FrameTimeSeries& GetFrameTimes();
+
+        static const FrameTimeSeries& GetCpuTimes();
+
+        /** nullptr for a layer that never updated. */
+        static const FrameTimeSeries* GetLayerTimes(StringId layer);
+
+        static std::span<const LayerFrameStats> GetLayers();
+
+        static uint64_t GetHitchCount();
+
+        static std::expected<void, ErrorStatus> WriteCsv(const std::filesystem::path& path);
+
+        static std::expected<void, ErrorStatus> WriteJson(const std::filesystem::path& path);
+    };
+
+    class FrameStatsLayerScope
+    {
+    public:
+        FrameStatsLayerScope(StringId layer) { FrameStats::BeginLayer(layer); }
+
+        ~FrameStatsLayerScope() { FrameStats::EndLayer(); }
+
+        FrameStatsLayerScope(const FrameStatsLayerScope&) = delete;
+        FrameStatsLayerScope& operator=(const FrameStatsLayerScope&) = delete;
+    };
+}// namespace Engine
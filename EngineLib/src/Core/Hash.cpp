@@ -0,0 +1,139 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Hash class implementation
+ */
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ENGINE_HASH_CPUID
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define ENGINE_HASH_CPUID
+#endif
+
+#include "Hash.hpp"
+
+#include <atomic>
+
+namespace Engine
+{
+    namespace
+    {
+        /** AVX2 needs the CPU to have it and the OS to save the 256 bit registers on context switches. */
+        bool CpuHasAvx2()
+        {
+#ifdef ENGINE_HASH_CPUID
+            constexpr uint32_t OsXsave = 1u << 27;
+            constexpr uint32_t Avx = 1u << 28;
+            constexpr uint32_t Avx2 = 1u << 5;
+            constexpr uint64_t YmmState = 0x6;
+
+            uint32_t registers[4]{};
+#ifdef _MSC_VER
+            __cpuid(reinterpret_cast<int*>(registers), 0);
+            if (registers[0] < 7) { return false; }
+            __cpuid(reinterpret_cast<int*>(registers), 1);
+            if ((registers[2] & (OsXsave | Avx)) != (OsXsave | Avx)) { return false; }
+            if ((_xgetbv(0) & YmmState) != YmmState) { return false; }
+            __cpuidex(reinterpret_cast<int*>(registers), 7, 0);
+#else
+            if (__get_cpuid_max(0, nullptr) < 7) { return false; }
+            __cpuid(1, registers[0], registers[1], registers[2], registers[3]);
+            if ((registers[2] & (OsXsave | Avx)) != (OsXsave | Avx)) { return false; }
+            // The _xgetbv intrinsic needs -mxsave, which would allow XSAVE code in the rest of the file.
+            uint32_t low{};
+            uint32_t high{};
+            __asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            if (((static_cast<uint64_t>(high) << 32 | low) & YmmState) != YmmState) { return false; }
+            __cpuid_count(7, 0, registers[0], registers[1], registers[2], registers[3]);
+#endif
+            return 0 != (registers[1] & Avx2);
+#else
+            return false;
+#endif
+        }
+
+        std::atomic<Hash::LongPath>& GetLongPathState()
+        {
+            static std::atomic<Hash::LongPath> path = [] {
+                if (Hash::IsLongPathSupported(Hash::LongPath::AVX2)) { return Hash::LongPath::AVX2; }
+                if (Hash::IsLongPathSupported(Hash::LongPath::SSE2)) { return Hash::LongPath::SSE2; }
+                return Hash::LongPath::Scalar;
+            }();
+            return path;
+        }
+    }// namespace
+
+    uint64_t Hash::Compute(const void* data, size_t size, uint64_t seed)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (size < LongInputSize) { return ComputeShort(bytes, size, seed); }
+        return ComputeLong(bytes, size, seed);
+    }
+
+    Hash::LongPath Hash::GetLongPath() { return GetLongPathState().load(std::memory_order_relaxed); }
+
+    bool Hash::SetLongPath(LongPath path)
+    {
+        if (!IsLongPathSupported(path)) { return false; }
+        GetLongPathState().store(path, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Hash::IsLongPathSupported(LongPath path)
+    {
+        switch (path)
+        {
+            case LongPath::Scalar:
+                return true;
+            case LongPath::SSE2:
+                return nullptr != GetSse2Kernel();
+            case LongPath::AVX2:
+            {
+                static const bool supported = nullptr != GetAvx2Kernel() && CpuHasAvx2();
+                return supported;
+            }
+        }
+        return false;
+    }
+
+    const char* Hash::GetLongPathName(LongPath path)
+    {
+        switch (path)
+        {
+            case LongPath::Scalar:
+                return "Scalar";
+            case LongPath::SSE2:
+                return "SSE2";
+            case LongPath::AVX2:
+                return "AVX2";
+        }
+        return "Unknown";
+    }
+
+    uint64_t Hash::ComputeLong(const uint8_t* data, size_t size, uint64_t seed)
+    {
+        LongKernel kernel{};
+        switch (GetLongPath())
+        {
+            case LongPath::Scalar:
+                return ComputeLongScalar(data, size, seed);
+            case LongPath::SSE2:
+                kernel = GetSse2Kernel();
+                break;
+            case LongPath::AVX2:
+                kernel = GetAvx2Kernel();
+                break;
+        }
+
+        auto accumulators = InitAccumulators(seed);
+        kernel(accumulators.data(), data, size, Secret.data());
+        return MergeAccumulators(accumulators, size);
+    }
+}// namespace Engine
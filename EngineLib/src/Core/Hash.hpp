@@ -0,0 +1,165 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Hash class definition
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include <Core/BufferView.hpp>
+
+namespace Engine
+{
+    /**
+     * Fast 64 bit non cryptographic hash for lookups, cache keys and checksums, never for anything security related.
+     *
+     * Inputs shorter than LongInputSize use a wyhash style mix of 128 bit multiplies. Longer inputs are consumed in
+     * 64 byte stripes by eight independent accumulators in the style of XXH3, which run on SSE2 or AVX2 when the
+     * CPU has them, picked on first use. Every path gives the same value for the same bytes, and string hashes are constexpr so names
+     * can be hashed at compile time.
+     */
+    class Hash
+    {
+    public:
+        static constexpr size_t LongInputSize = 1024;
+
+        enum class LongPath : uint8_t
+        {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+    public:
+        static constexpr uint64_t Compute(std::string_view text, uint64_t seed = 0);
+
+        static uint64_t Compute(const void* data, size_t size, uint64_t seed = 0);
+
+        static uint64_t Compute(BufferView data, uint64_t seed = 0) { return Compute(data.Data(), data.GetSize(), seed); }
+
+        /** Hashes the object representation, T must not contain padding. */
+        template <typename T>
+        static uint64_t ComputeValue(const T& value, uint64_t seed = 0);
+
+        /** Order dependent, Combine(Combine(seed, a), b) differs from Combine(Combine(seed, b), a). */
+        static constexpr uint64_t Combine(uint64_t seed, uint64_t value);
+
+        /** Avalanches an integer key, every input bit affects every output bit. */
+        static constexpr uint64_t Mix(uint64_t value);
+
+        /** Instruction set used for long inputs, the widest one both the build and the CPU support by default. */
+        static LongPath GetLongPath();
+
+        /** Overrides the long input path for benchmarks and tests, false and no change when it is not supported. */
+        static bool SetLongPath(LongPath path);
+
+        static bool IsLongPathSupported(LongPath path);
+
+        /** "AVX2", "SSE2" or "Scalar". */
+        static const char* GetLongPathName(LongPath path);
+
+        static const char* GetLongPathName() { return GetLongPathName(GetLongPath()); }
+
+    private:
+        static constexpr std::array<uint64_t, 4> WyPrimes = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+                                                              0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+        static constexpr size_t StripeSize = 64;
+        static constexpr size_t StripesPerBlock = 16;
+        static constexpr size_t BlockSize = StripeSize * StripesPerBlock;
+        static constexpr size_t Lanes = 8;
+        static constexpr size_t ScrambleSecret = 24;
+        static constexpr size_t LastStripeSecret = 9;
+        static constexpr size_t MergeSecret = 16;
+        static constexpr uint64_t Prime32 = 0x9E3779B1ull;
+
+        /** splitmix64 output, any well mixed constants work as long as they never change. */
+        static constexpr std::array<uint64_t, 32> Secret = []() {
+            std::array<uint64_t, 32> secret{};
+            uint64_t state = 0x6A09E667F3BCC908ull;
+            for (auto& word: secret)
+            {
+                state += 0x9E3779B97F4A7C15ull;
+                auto z = state;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+                word = z ^ (z >> 31);
+            }
+            return secret;
+        }();
+
+        static constexpr std::array<uint64_t, Lanes> AccumulatorInit = {
+                0x00000000C2B2AE3Dull, 0x9E3779B185EBCA87ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull,
+                0x85EBCA77C2B2AE63ull, 0x0000000085EBCA77ull, 0x27D4EB2F165667C5ull, 0x000000009E3779B1ull};
+
+        template <typename Byte>
+        static constexpr uint64_t Read64(const Byte* data);
+
+        template <typename Byte>
+        static constexpr uint64_t Read32(const Byte* data);
+
+        static constexpr void Multiply(uint64_t& a, uint64_t& b);
+
+        static constexpr uint64_t MultiplyFold(uint64_t a, uint64_t b);
+
+        template <typename Byte>
+        static constexpr uint64_t ComputeShort(const Byte* data, size_t size, uint64_t seed);
+
+        template <typename Byte>
+        static constexpr void AccumulateStripe(std::array<uint64_t, Lanes>& accumulators, const Byte* data,
+                                               size_t secretOffset);
+
+        static constexpr void ScrambleAccumulators(std::array<uint64_t, Lanes>& accumulators);
+
+        static constexpr std::array<uint64_t, Lanes> InitAccumulators(uint64_t seed);
+
+        static constexpr uint64_t MergeAccumulators(const std::array<uint64_t, Lanes>& accumulators, size_t size);
+
+        template <typename Byte>
+        static constexpr uint64_t ComputeLongScalar(const Byte* data, size_t size, uint64_t seed);
+
+        static uint64_t ComputeLong(const uint8_t* data, size_t size, uint64_t seed);
+
+        /**
+         * Vector versions of the block and stripe loop of ComputeLongScalar, run between InitAccumulators and
+         * MergeAccumulators. Each lives in its own translation unit so only HashAvx2.cpp is built for AVX2, and they
+         * take the secret as a pointer so no inline function gets compiled with instructions other CPUs lack.
+         */
+        using LongKernel = void (*)(uint64_t* accumulators, const uint8_t* data, size_t size, const uint64_t* secret);
+
+        /** nullptr when the target has no SSE2, HashSse2.cpp. */
+        static LongKernel GetSse2Kernel();
+
+        /** nullptr when HashAvx2.cpp is not built with AVX2 enabled. */
+        static LongKernel GetAvx2Kernel();
+
+        /** Shared body of the vector kernels, Ops wraps the intrinsics of one vector width, HashKernel.impl.hpp. */
+        template <typename Ops>
+        static void AccumulateLong(uint64_t* accumulators, const uint8_t* data, size_t size, const uint64_t* secret);
+    };
+
+    /** Transparent hasher, lets unordered containers keyed by std::string be searched with a string_view. */
+    struct StringHash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view text) const { return static_cast<size_t>(Hash::Compute(text)); }
+    };
+
+    namespace Literals
+    {
+        consteval uint64_t operator""_hash(const char* text, size_t size);
+    }// namespace Literals
+}// namespace Engine
+
+#include "Hash.impl.hpp"
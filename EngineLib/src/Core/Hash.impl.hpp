@@ -0,0 +1,244 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Hash templated functions implementation
+ */
+
+#include <bit>
+#include <cstring>
+#include "Hash.hpp"
+
+namespace Engine
+{
+    constexpr uint64_t Hash::Compute(std::string_view text, uint64_t seed)
+    {
+        if consteval
+        {
+            if (text.size() < LongInputSize) { return ComputeShort(text.data(), text.size(), seed); }
+            return ComputeLongScalar(text.data(), text.size(), seed);
+        }
+        else { return Compute(text.data(), text.size(), seed); }
+    }
+
+    template <typename T>
+    uint64_t Hash::ComputeValue(const T& value, uint64_t seed)
+    {
+        static_assert(std::has_unique_object_representations_v<T>,
+                      "Only types without padding can be hashed by their bytes!");
+        return Compute(&value, sizeof(T), seed);
+    }
+
+    constexpr uint64_t Hash::Combine(uint64_t seed, uint64_t value)
+    {
+        return MultiplyFold(seed ^ WyPrimes[0], value ^ WyPrimes[1]);
+    }
+
+    constexpr uint64_t Hash::Mix(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    template <typename Byte>
+    constexpr uint64_t Hash::Read64(const Byte* data)
+    {
+        if consteval
+        {
+            uint64_t value = 0;
+            for (size_t i = 0; i < 8; i++) { value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (i * 8); }
+            return value;
+        }
+        else
+        {
+            uint64_t value;
+            memcpy(&value, data, sizeof(value));
+            if constexpr (std::endian::native == std::endian::big) { value = std::byteswap(value); }
+            return value;
+        }
+    }
+
+    template <typename Byte>
+    constexpr uint64_t Hash::Read32(const Byte* data)
+    {
+        if consteval
+        {
+            uint32_t value = 0;
+            for (size_t i = 0; i < 4; i++) { value |= static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << (i * 8); }
+            return value;
+        }
+        else
+        {
+            uint32_t value;
+            memcpy(&value, data, sizeof(value));
+            if constexpr (std::endian::native == std::endian::big) { value = std::byteswap(value); }
+            return value;
+        }
+    }
+
+    constexpr void Hash::Multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 UInt128;
+        auto product = static_cast<UInt128>(a) * b;
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+#else
+        uint64_t highA = a >> 32, highB = b >> 32, lowA = static_cast<uint32_t>(a), lowB = static_cast<uint32_t>(b);
+        uint64_t high = highA * highB, middle0 = highA * lowB, middle1 = highB * lowA, low = lowA * lowB;
+        uint64_t t = low + (middle0 << 32);
+        uint64_t carry = t < low;
+        uint64_t result = t + (middle1 << 32);
+        carry += result < t;
+        a = result;
+        b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+    }
+
+    constexpr uint64_t Hash::MultiplyFold(uint64_t a, uint64_t b)
+    {
+        Multiply(a, b);
+        return a ^ b;
+    }
+
+    template <typename Byte>
+    constexpr uint64_t Hash::ComputeShort(const Byte* data, size_t size, uint64_t seed)
+    {
+        seed ^= MultiplyFold(seed ^ WyPrimes[0], WyPrimes[1]);
+
+        uint64_t a = 0, b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                auto shift = (size >> 3) << 2;
+                a = (Read32(data) << 32) | Read32(data + shift);
+                b = (Read32(data + size - 4) << 32) | Read32(data + size - 4 - shift);
+            }
+            else if (size > 0)
+            {
+                a = (static_cast<uint64_t>(static_cast<uint8_t>(data[0])) << 16) |
+                    (static_cast<uint64_t>(static_cast<uint8_t>(data[size >> 1])) << 8) |
+                    static_cast<uint8_t>(data[size - 1]);
+            }
+        }
+        else
+        {
+            auto remaining = size;
+            const auto* p = data;
+            if (remaining > 48)
+            {
+                // Three independent chains keep the multipliers busy.
+                auto see1 = seed, see2 = seed;
+                do {
+                    seed = MultiplyFold(Read64(p) ^ WyPrimes[1], Read64(p + 8) ^ seed);
+                    see1 = MultiplyFold(Read64(p + 16) ^ WyPrimes[2], Read64(p + 24) ^ see1);
+                    see2 = MultiplyFold(Read64(p + 32) ^ WyPrimes[3], Read64(p + 40) ^ see2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (remaining > 16)
+            {
+                seed = MultiplyFold(Read64(p) ^ WyPrimes[1], Read64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = Read64(p + remaining - 16);
+            b = Read64(p + remaining - 8);
+        }
+
+        a ^= WyPrimes[1];
+        b ^= seed;
+        Multiply(a, b);
+        return MultiplyFold(a ^ WyPrimes[0] ^ size, b ^ WyPrimes[1]);
+    }
+
+    template <typename Byte>
+    constexpr void Hash::AccumulateStripe(std::array<uint64_t, Lanes>& accumulators, const Byte* data,
+                                          size_t secretOffset)
+    {
+        for (size_t i = 0; i < Lanes; i++)
+        {
+            auto value = Read64(data + i * 8);
+            auto key = value ^ Secret[secretOffset + i];
+            accumulators[i ^ 1] += value;
+            accumulators[i] += (key & 0xFFFFFFFFull) * (key >> 32);
+        }
+    }
+
+    constexpr void Hash::ScrambleAccumulators(std::array<uint64_t, Lanes>& accumulators)
+    {
+        for (size_t i = 0; i < Lanes; i++)
+        {
+            auto value = accumulators[i];
+            value ^= value >> 47;
+            value ^= Secret[ScrambleSecret + i];
+            accumulators[i] = value * Prime32;
+        }
+    }
+
+    constexpr std::array<uint64_t, Hash::Lanes> Hash::InitAccumulators(uint64_t seed)
+    {
+        auto accumulators = AccumulatorInit;
+        for (size_t i = 0; i < Lanes; i++) { accumulators[i] += i & 1 ? 0 - seed : seed; }
+        return accumulators;
+    }
+
+    constexpr uint64_t Hash::MergeAccumulators(const std::array<uint64_t, Lanes>& accumulators, size_t size)
+    {
+        uint64_t result = size * 0x9E3779B185EBCA87ull;
+        for (size_t i = 0; i < Lanes; i += 2)
+        {
+            result += MultiplyFold(accumulators[i] ^ Secret[MergeSecret + i],
+                                   accumulators[i + 1] ^ Secret[MergeSecret + i + 1]);
+        }
+        result ^= result >> 37;
+        result *= 0x165667919E3779F9ull;
+        result ^= result >> 32;
+        return result;
+    }
+
+    template <typename Byte>
+    constexpr uint64_t Hash::ComputeLongScalar(const Byte* data, size_t size, uint64_t seed)
+    {
+        auto accumulators = InitAccumulators(seed);
+
+        // The final stripe always covers the last 64 bytes, so the last block is left to the tail.
+        auto blockCount = (size - 1) / BlockSize;
+        for (size_t block = 0; block < blockCount; block++)
+        {
+            for (size_t stripe = 0; stripe < StripesPerBlock; stripe++)
+            {
+                AccumulateStripe(accumulators, data + block * BlockSize + stripe * StripeSize, stripe);
+            }
+            ScrambleAccumulators(accumulators);
+        }
+
+        const auto* tail = data + blockCount * BlockSize;
+        auto stripeCount = (size - 1 - blockCount * BlockSize) / StripeSize;
+        for (size_t stripe = 0; stripe < stripeCount; stripe++)
+        {
+            AccumulateStripe(accumulators, tail + stripe * StripeSize, stripe);
+        }
+        AccumulateStripe(accumulators, data + size - StripeSize, LastStripeSecret);
+
+        return MergeAccumulators(accumulators, size);
+    }
+
+    namespace Literals
+    {
+        consteval uint64_t operator""_hash(const char* text, size_t size) { return Hash::Compute({text, size}); }
+    }// namespace Literals
+}// namespace Engine
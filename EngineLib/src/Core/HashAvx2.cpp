@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Hash AVX2 kernel implementation, the build enables AVX2 for this file alone and Hash.cpp only calls it on CPUs
+ * that have it
+ */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ENGINE_HASH_AVX2
+#endif
+
+#include "HashKernel.impl.hpp"
+
+namespace Engine
+{
+#if defined(ENGINE_HASH_AVX2)
+    namespace
+    {
+        struct Avx2Ops {
+            using Vector = __m256i;
+
+            static Vector Load(const void* p) { return _mm256_loadu_si256(static_cast<const Vector*>(p)); }
+            static void Store(void* p, Vector v) { _mm256_storeu_si256(static_cast<Vector*>(p), v); }
+            static Vector Broadcast(uint64_t value) { return _mm256_set1_epi64x(static_cast<int64_t>(value)); }
+            static Vector Add(Vector a, Vector b) { return _mm256_add_epi64(a, b); }
+            static Vector ExclusiveOr(Vector a, Vector b) { return _mm256_xor_si256(a, b); }
+            static Vector Multiply32(Vector a, Vector b) { return _mm256_mul_epu32(a, b); }
+            static Vector HighToLow(Vector a) { return _mm256_srli_epi64(a, 32); }
+            static Vector SwapLanes(Vector a) { return _mm256_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)); }
+            static Vector ShiftRight47(Vector a) { return _mm256_srli_epi64(a, 47); }
+            static Vector ShiftLeft32(Vector a) { return _mm256_slli_epi64(a, 32); }
+        };
+    }// namespace
+
+    Hash::LongKernel Hash::GetAvx2Kernel() { return &AccumulateLong<Avx2Ops>; }
+#else
+    Hash::LongKernel Hash::GetAvx2Kernel() { return nullptr; }
+#endif
+}// namespace Engine
@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Hash vector kernel implementation, included only by HashSse2.cpp and HashAvx2.cpp
+ */
+
+#include "Hash.hpp"
+
+namespace Engine
+{
+    template <typename Ops>
+    void Hash::AccumulateLong(uint64_t* accumulators, const uint8_t* data, size_t size, const uint64_t* secret)
+    {
+        // Same stripes, lanes and secret offsets as ComputeLongScalar, each vector holds several accumulators.
+        using Vector = typename Ops::Vector;
+        constexpr size_t WordsPerVector = sizeof(Vector) / sizeof(uint64_t);
+        constexpr size_t VectorCount = Lanes / WordsPerVector;
+
+        const auto prime = Ops::Broadcast(Prime32);
+        Vector vectors[VectorCount];
+        for (size_t i = 0; i < VectorCount; i++) { vectors[i] = Ops::Load(accumulators + i * WordsPerVector); }
+
+        auto accumulate = [&](const uint8_t* stripe, size_t secretOffset) {
+            for (size_t i = 0; i < VectorCount; i++)
+            {
+                auto value = Ops::Load(stripe + i * sizeof(Vector));
+                auto key = Ops::ExclusiveOr(value, Ops::Load(secret + secretOffset + i * WordsPerVector));
+                auto product = Ops::Multiply32(key, Ops::HighToLow(key));
+                vectors[i] = Ops::Add(vectors[i], Ops::Add(product, Ops::SwapLanes(value)));
+            }
+        };
+
+        auto scramble = [&]() {
+            for (size_t i = 0; i < VectorCount; i++)
+            {
+                auto value = vectors[i];
+                value = Ops::ExclusiveOr(value, Ops::ShiftRight47(value));
+                value = Ops::ExclusiveOr(value, Ops::Load(secret + ScrambleSecret + i * WordsPerVector));
+                auto low = Ops::Multiply32(value, prime);
+                auto high = Ops::Multiply32(Ops::HighToLow(value), prime);
+                vectors[i] = Ops::Add(low, Ops::ShiftLeft32(high));
+            }
+        };
+
+        auto blockCount = (size - 1) / BlockSize;
+        for (size_t block = 0; block < blockCount; block++)
+        {
+            for (size_t stripe = 0; stripe < StripesPerBlock; stripe++)
+            {
+                accumulate(data + block * BlockSize + stripe * StripeSize, stripe);
+            }
+            scramble();
+        }
+
+        const auto* tail = data + blockCount * BlockSize;
+        auto stripeCount = (size - 1 - blockCount * BlockSize) / StripeSize;
+        for (size_t stripe = 0; stripe < stripeCount; stripe++) { accumulate(tail + stripe * StripeSize, stripe); }
+        accumulate(data + size - StripeSize, LastStripeSecret);
+
+        for (size_t i = 0; i < VectorCount; i++) { Ops::Store(accumulators + i * WordsPerVector, vectors[i]); }
+    }
+}// namespace Engine
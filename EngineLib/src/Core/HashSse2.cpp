@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Hash SSE2 kernel implementation
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ENGINE_HASH_SSE2
+#endif
+
+#include "HashKernel.impl.hpp"
+
+namespace Engine
+{
+#if defined(ENGINE_HASH_SSE2)
+    namespace
+    {
+        struct Sse2Ops {
+            using Vector = __m128i;
+
+            static Vector Load(const void* p) { return _mm_loadu_si128(static_cast<const Vector*>(p)); }
+            static void Store(void* p, Vector v) { _mm_storeu_si128(static_cast<Vector*>(p), v); }
+            static Vector Broadcast(uint64_t value) { return _mm_set1_epi64x(static_cast<int64_t>(value)); }
+            static Vector Add(Vector a, Vector b) { return _mm_add_epi64(a, b); }
+            static Vector ExclusiveOr(Vector a, Vector b) { return _mm_xor_si128(a, b); }
+            static Vector Multiply32(Vector a, Vector b) { return _mm_mul_epu32(a, b); }
+            static Vector HighToLow(Vector a) { return _mm_srli_epi64(a, 32); }
+            static Vector SwapLanes(Vector a) { return _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)); }
+            static Vector ShiftRight47(Vector a) { return _mm_srli_epi64(a, 47); }
+            static Vector ShiftLeft32(Vector a) { return _mm_slli_epi64(a, 32); }
+        };
+    }// namespace
+
+    Hash::LongKernel Hash::GetSse2Kernel() { return &AccumulateLong<Sse2Ops>; }
+#else
+    Hash::LongKernel Hash::GetSse2Kernel() { return nullptr; }
+#endif
+}// namespace Engine
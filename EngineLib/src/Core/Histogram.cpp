@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Histogram class implementation
+ */
+
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Engine
+{
+    void Histogram::Record(uint64_t value, uint64_t count)
+    {
+        value = std::min(value, MaxValue);
+        m_Counts[GetIndex(value)] += count;
+        m_Count += count;
+        m_Min = std::min(m_Min, value);
+        m_Max = std::max(m_Max, value);
+        m_Sum += static_cast<double>(value) * static_cast<double>(count);
+    }
+
+    void Histogram::Merge(const Histogram& other)
+    {
+        for (uint32_t index = 0; index < BucketCount; index++) { m_Counts[index] += other.m_Counts[index]; }
+        m_Count += other.m_Count;
+        m_Min = std::min(m_Min, other.m_Min);
+        m_Max = std::max(m_Max, other.m_Max);
+        m_Sum += other.m_Sum;
+    }
+
+    void Histogram::Reset() { *this = Histogram(); }
+
+    uint64_t Histogram::GetValueAtPercentile(double percentile) const
+    {
+        if (0 == m_Count) { return 0; }
+
+        auto target = static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * m_Count));
+        target = std::max<uint64_t>(target, 1);
+
+        uint64_t seen = 0;
+        for (uint32_t index = 0; index < BucketCount; index++)
+        {
+            seen += m_Counts[index];
+            if (seen >= target) { return std::clamp(GetHighestValue(index), m_Min, m_Max); }
+        }
+        return m_Max;
+    }
+
+    uint32_t Histogram::GetIndex(uint64_t value)
+    {
+        // Values below 2^SubBucketBits map one to one, above that every power of two range gets 2^(SubBucketBits - 1).
+        auto width = static_cast<uint32_t>(std::bit_width(value));
+        auto shift = width > SubBucketBits ? width - SubBucketBits : 0;
+        return (shift << (SubBucketBits - 1)) + static_cast<uint32_t>(value >> shift);
+    }
+
+    uint64_t Histogram::GetHighestValue(uint32_t index)
+    {
+        constexpr uint32_t Linear = 1u << SubBucketBits;
+        if (index < Linear) { return index; }
+
+        auto shift = (index >> (SubBucketBits - 1)) - 1;
+        auto subBucket = index - (shift << (SubBucketBits - 1));
+        return ((uint64_t(subBucket) + 1) << shift) - 1;
+    }
+}// namespace Engine
@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Histogram class definition
+ */
+
+#include <array>
+#include <cstdint>
+
+namespace Engine
+{
+    /**
+     * Log-linear histogram of integer values in the style of HdrHistogram.
+     *
+     * Every power of two range is split into 128 buckets, so a recorded value is off by less than 1% whatever its
+     * magnitude, and recording is a couple of shifts and an increment. Values of 2^40 and above are clamped, in
+     * nanoseconds that is about 18 minutes. Count, min, max and mean are exact.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr uint32_t SubBucketBits = 8;
+        static constexpr uint32_t MaxValueBits = 40;
+        static constexpr uint64_t MaxValue = (uint64_t(1) << MaxValueBits) - 1;
+        static constexpr uint32_t BucketCount = (MaxValueBits - SubBucketBits + 2) << (SubBucketBits - 1);
+
+    public:
+        void Record(uint64_t value, uint64_t count = 1);
+
+        void Merge(const Histogram& other);
+
+        void Reset();
+
+        /** Highest value of the bucket holding the given percentile (0 to 100), 0 when empty. */
+        uint64_t GetValueAtPercentile(double percentile) const;
+
+        uint64_t GetCount() const { return m_Count; }
+
+        uint64_t GetMin() const { return m_Count ? m_Min : 0; }
+
+        uint64_t GetMax() const { return m_Max; }
+
+        double GetMean() const { return m_Count ? m_Sum / static_cast<double>(m_Count) : 0.0; }
+
+    private:
+        static uint32_t GetIndex(uint64_t value);
+
+        static uint64_t GetHighestValue(uint32_t index);
+
+    private:
+        std::array<uint64_t, BucketCount> m_Counts{};
+        uint64_t m_Count{};
+        uint64_t m_Min = UINT64_MAX;
+        uint64_t m_Max{};
+        double m_Sum{};
+    };
+}// namespace Engine
@@ -1,11 +1,198 @@
 #include "Log.hpp"
+#include "BinaryWriter.hpp"
+#include "Clock.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+
+#ifdef _WIN32
+#include <Platform/WindowInstance.hpp>
+#endif
 
 namespace Engine
 {
+    struct LogRing {
+        explicit LogRing(uint32_t capacity) : Data(new uint8_t[capacity]), Capacity(capacity) {}
+
+        alignas(64) std::atomic<uint64_t> Head{};
+        alignas(64) std::atomic<uint64_t> Tail{};
+        alignas(64) std::unique_ptr<uint8_t[]> Data;
+        uint32_t Capacity;
+        std::atomic<uint64_t> Dropped{};
+        std::atomic<bool> Abandoned{};
+    };
+
+    namespace
+    {
+        constexpr uint32_t MinRingSize = 4096;
+        constexpr uint32_t RecordAlignment = 16;
+        constexpr uint8_t PaddingRecordFlag = 1;
+        constexpr uint8_t DeferredRecordFlag = 2;
+
+        struct LogRecordHeader {
+            uint32_t Size;
+            LogLevel Level;
+            uint8_t Flags;
+            LogCategory Category;
+            uint8_t Reserved;
+            int64_t Timestamp;
+        };
+        static_assert(sizeof(LogRecordHeader) % RecordAlignment == 0);
+
+        /** Follows the header of deferred records, the encoded arguments come after it. */
+        struct DeferredRecord {
+            const char* Format;
+            uint32_t PayloadSize;
+            uint32_t Reserved;
+        };
+
+        template <typename T>
+        void AppendBinary(std::string& output, const T& value)
+        {
+            output.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        int64_t ToNanoseconds(int64_t ticks)
+        {
+            return static_cast<int64_t>(Clock::ToNanos(static_cast<uint64_t>(ticks)));
+        }
+
+        constexpr uint32_t AlignRecord(size_t size)
+        {
+            return static_cast<uint32_t>((size + RecordAlignment - 1) & ~size_t(RecordAlignment - 1));
+        }
+
+        /**
+         * Appends to a binary log of the current format. The decoder reads the whole file with the layout of its one
+         * header, so a file of another version or no log at all is started over instead.
+         */
+        FILE* OpenBinaryLog(const std::string& path)
+        {
+            FILE* file = fopen(path.c_str(), "ab+");
+            if (!file) { return nullptr; }
+
+            const BinaryHeader expected{LogFileFormat::Magic, LogFileFormat::Version};
+            if (0 == fseek(file, 0, SEEK_END) && 0 == ftell(file))
+            {
+                fwrite(&expected, sizeof(expected), 1, file);
+                return file;
+            }
+
+            BinaryHeader header{};
+            if (0 == fseek(file, 0, SEEK_SET) && 1 == fread(&header, sizeof(header), 1, file) &&
+                expected.Magic == header.Magic && expected.Version == header.Version)
+            {
+                // A write may not follow a read without a seek in between.
+                fseek(file, 0, SEEK_END);
+                return file;
+            }
+
+            fclose(file);
+            fprintf(stderr, "[WARNING] Binary log file %s has another format, starting it over\n", path.c_str());
+            file = fopen(path.c_str(), "wb");
+            if (file) { fwrite(&expected, sizeof(expected), 1, file); }
+            return file;
+        }
+
+        /** The thread's ring for the current logger, marked abandoned when the thread exits. */
+        struct ThreadRing {
+            ~ThreadRing()
+            {
+                if (Ring) { Ring->Abandoned.store(true, std::memory_order_release); }
+            }
+
+            std::shared_ptr<LogRing> Ring;
+            uint64_t Generation{};
+        };
+
+        thread_local ThreadRing t_Ring;
+        std::atomic<uint64_t> s_Generation;
+
+        /** Threads in Logger::InstanceScope, spread over cache lines so logging threads do not share one counter. */
+        constexpr uint32_t InstanceUserShards = 16;
+
+        struct alignas(64) InstanceUserCount {
+            std::atomic<uint32_t> Count;
+        };
+
+        InstanceUserCount s_InstanceUsers[InstanceUserShards];
+        std::atomic<uint32_t> s_NextInstanceUserShard;
+        thread_local std::atomic<uint32_t>* t_InstanceUsers;
+
+        void OnFatalSignal(int signal);
+
+        void InstallCrashHandlers()
+        {
+            static bool installed = false;
+            if (installed) { return; }
+            installed = true;
+
+            for (auto signal: {SIGSEGV, SIGABRT, SIGFPE, SIGILL}) { std::signal(signal, OnFatalSignal); }
+#ifdef _WIN32
+            SetUnhandledExceptionFilter([](EXCEPTION_POINTERS*) -> LONG {
+                Logger::FlushFromCrash();
+                return EXCEPTION_CONTINUE_SEARCH;
+            });
+#else
+            std::signal(SIGBUS, OnFatalSignal);
+#endif
+        }
+    }// namespace
 
     std::shared_ptr<Logger> Logger::s_Logger;
+    std::atomic<Logger*> Logger::s_Instance;
+    std::atomic<uint8_t> Logger::s_DisabledLevels[LogCategoryCount];
+
+    namespace
+    {
+        void OnFatalSignal(int signal)
+        {
+            Logger::FlushFromCrash();
+            std::signal(signal, SIG_DFL);
+            std::raise(signal);
+        }
+    }// namespace
+
+    Logger::InstanceScope::InstanceScope()
+    {
+        if (!t_InstanceUsers)
+        {
+            auto shard = s_NextInstanceUserShard.fetch_add(1, std::memory_order_relaxed) % InstanceUserShards;
+            t_InstanceUsers = &s_InstanceUsers[shard].Count;
+        }
+        m_Users = t_InstanceUsers;
+
+        // Both sequentially consistent, like the store and the loads in Shutdown(): either this load sees nullptr or
+        // Shutdown() sees the count and waits.
+        m_Users->fetch_add(1, std::memory_order_seq_cst);
+        m_Logger = s_Instance.load(std::memory_order_seq_cst);
+    }
 
-    void Logger::Create() { Logger::s_Logger = std::make_shared<Logger>(); }
+    Logger::InstanceScope::~InstanceScope() { m_Users->fetch_sub(1, std::memory_order_release); }
+
+    bool LogRateLimiter::Allow(uint32_t perSecond, uint64_t& suppressed)
+    {
+        const auto now = static_cast<int64_t>(Clock::Now());
+        const auto window = static_cast<int64_t>(Clock::GetFrequency());
+
+        // Threads racing on a new window may let a few extra messages through, the limit is approximate.
+        auto start = m_WindowStart.load(std::memory_order_relaxed);
+        if (now - start >= window && m_WindowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+        {
+            m_Count.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_Count.fetch_add(1, std::memory_order_relaxed) < perSecond)
+        {
+            suppressed = m_Suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        m_Suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
 
 #ifdef LWLOG
     void Logger::Init()
@@ -33,10 +220,478 @@ namespace Engine
     Logger* Logger::GetInstance() { return s_Logger.get(); }
 
 #else
-    void Engine::Logger::Init() {}
+    void Logger::Init()
+    {
+        m_RingSize = std::bit_ceil(std::max(m_Spec.RingSize, MinRingSize));
+        m_MaxPayloadSize = m_RingSize / 2 - sizeof(LogRecordHeader) - sizeof(DeferredRecord);
+        m_Generation = s_Generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (!m_Spec.FilePath.empty())
+        {
+            m_File = fopen(m_Spec.FilePath.c_str(), "ab");
+            if (!m_File) { fprintf(stderr, "[ERROR] Can not open log file %s\n", m_Spec.FilePath.c_str()); }
+        }
+        if (!m_Spec.BinaryFilePath.empty())
+        {
+            m_BinaryFile = OpenBinaryLog(m_Spec.BinaryFilePath);
+            if (!m_BinaryFile)
+            {
+                fprintf(stderr, "[ERROR] Can not open binary log file %s\n", m_Spec.BinaryFilePath.c_str());
+            }
+        }
+
+        m_Running.store(true, std::memory_order_release);
+        m_Writer = std::thread(&Logger::WriterLoop, this);
+    }
+
+    void Logger::Destroy()
+    {
+        if (!m_Running.exchange(false, std::memory_order_acq_rel)) { return; }
+
+        {
+            std::lock_guard lock(m_WakeMutex);
+            m_Wake.notify_one();
+        }
+        if (m_Writer.joinable()) { m_Writer.join(); }
+        Drain();
+
+        if (m_File)
+        {
+            fclose(m_File);
+            m_File = nullptr;
+        }
+        if (m_BinaryFile)
+        {
+            fclose(m_BinaryFile);
+            m_BinaryFile = nullptr;
+        }
+    }
+
+    void Logger::Create(const LoggerSpec& spec)
+    {
+        if (s_Logger) { return; }
+
+        s_Logger = std::make_shared<Logger>(spec);
+        s_Instance.store(s_Logger.get(), std::memory_order_release);
+
+        static bool exitHandlerInstalled = false;
+        if (!exitHandlerInstalled)
+        {
+            exitHandlerInstalled = true;
+            std::atexit([]() { Logger::Shutdown(); });
+        }
+        if (spec.FlushOnCrash) { InstallCrashHandlers(); }
+    }
+
+    void Logger::Shutdown()
+    {
+        if (!s_Logger) { return; }
 
-    void Logger::Destroy() {}
+        // Messages from here on are written directly. The ones that already saw the logger finish their push first,
+        // so the final Drain() in Destroy() writes them out and no thread is left holding a freed logger.
+        s_Instance.store(nullptr, std::memory_order_seq_cst);
+        for (auto& users: s_InstanceUsers)
+        {
+            while (0 != users.Count.load(std::memory_order_seq_cst)) { std::this_thread::yield(); }
+        }
+
+        s_Logger->Destroy();
+        s_Logger.reset();
+    }
 
     Logger* Logger::GetInstance() { return s_Logger.get(); }
+
+    void Logger::Write(LogLevel level, const char* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        WriteV(LogCategory::General, level, format, args);
+        va_end(args);
+    }
+
+    void Logger::Write(LogCategory category, LogLevel level, const char* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        WriteV(category, level, format, args);
+        va_end(args);
+    }
+
+    void Logger::WriteV(LogLevel level, const char* format, va_list args)
+    {
+        WriteV(LogCategory::General, level, format, args);
+    }
+
+    void Logger::WriteV(LogCategory category, LogLevel level, const char* format, va_list args)
+    {
+        InstanceScope instance;
+        auto* logger = instance.Get();
+        if (logger && logger->m_Running.load(std::memory_order_relaxed))
+        {
+            logger->Push(category, level, format, args);
+        }
+        else { WriteDirect(category, level, format, args); }
+    }
+
+    void Logger::WriteSuppressed(LogCategory category, LogLevel level, uint64_t count, const char* file, int line)
+    {
+        Write(category, level, "%llu similar messages suppressed at %s:%d\n", static_cast<unsigned long long>(count),
+              file, line);
+    }
+
+    void Logger::SetCategoryLevel(LogCategory category, LogLevel minLevel)
+    {
+        auto severity = [](LogLevel level) {
+            return LogLevel::Memory == level ? 0 : static_cast<int>(level);
+        };
+
+        uint8_t disabled = 0;
+        for (auto level: {LogLevel::Debug, LogLevel::Info, LogLevel::Warning, LogLevel::Error, LogLevel::Memory})
+        {
+            if (severity(level) < severity(minLevel)) { disabled |= 1u << static_cast<uint32_t>(level); }
+        }
+        s_DisabledLevels[static_cast<size_t>(category)].store(disabled, std::memory_order_relaxed);
+    }
+
+    void Logger::Flush()
+    {
+        InstanceScope instance;
+        auto* logger = instance.Get();
+        if (logger) { logger->Drain(); }
+        else { fflush(stdout); }
+    }
+
+    uint64_t Logger::GetDroppedCount()
+    {
+        InstanceScope instance;
+        auto* logger = instance.Get();
+        return logger ? logger->m_Dropped.load(std::memory_order_relaxed) : 0;
+    }
+
+    const char* Logger::GetLevelPrefix(LogLevel level)
+    {
+        switch (level)
+        {
+            case LogLevel::Debug:
+                return "[DEBUG] ";
+            case LogLevel::Info:
+                return "[INFO] ";
+            case LogLevel::Warning:
+                return "[WARNING] ";
+            case LogLevel::Error:
+                return "[ERROR] ";
+            case LogLevel::Memory:
+                return "[MEMORY] ";
+            default:
+                return "";
+        }
+    }
+
+    void Logger::AppendPrefix(std::string& output, LogCategory category, LogLevel level)
+    {
+        output.append(GetLevelPrefix(level));
+        if (LogCategory::General != category)
+        {
+            output.push_back('[');
+            output.append(LogCategoryToString(category));
+            output.append("] ");
+        }
+    }
+
+    void Logger::WriteDirect(LogCategory category, LogLevel level, const char* format, va_list args)
+    {
+        std::string prefix;
+        AppendPrefix(prefix, category, level);
+        fputs(prefix.c_str(), stdout);
+        vfprintf(stdout, format, args);
+    }
+
+    void Logger::WriteEncoded(LogCategory category, LogLevel level, const char* format, BufferView payload)
+    {
+        std::string text;
+        LogFormat::Format(text, format, payload);
+        Write(category, level, "%s", text.c_str());
+    }
+
+    void Logger::FlushFromCrash()
+    {
+        InstanceScope instance;
+        auto* logger = instance.Get();
+        if (logger) { logger->Drain(true); }
+        fflush(stdout);
+    }
+
+    LogRing* Logger::GetThreadRing()
+    {
+        if (t_Ring.Ring && t_Ring.Generation == m_Generation) { return t_Ring.Ring.get(); }
+
+        // First message of this thread for this logger, the ring is shared with the writer so either side can go
+        // away first.
+        auto ring = std::make_shared<LogRing>(m_RingSize);
+        {
+            std::lock_guard lock(m_RingsMutex);
+            m_Rings.push_back(ring);
+        }
+        if (t_Ring.Ring) { t_Ring.Ring->Abandoned.store(true, std::memory_order_release); }
+        t_Ring.Ring = std::move(ring);
+        t_Ring.Generation = m_Generation;
+        return t_Ring.Ring.get();
+    }
+
+    uint8_t* Logger::Reserve(LogRing& ring, uint32_t size, uint64_t& nextHead)
+    {
+        const auto head = ring.Head.load(std::memory_order_relaxed);
+        const auto offset = static_cast<uint32_t>(head & (ring.Capacity - 1));
+
+        // Records never wrap, the rest of the ring is skipped with a padding record instead.
+        auto padding = offset + size > ring.Capacity ? ring.Capacity - offset : 0;
+        auto required = padding + size;
+
+        while (ring.Capacity - (head - ring.Tail.load(std::memory_order_acquire)) < required)
+        {
+            if (LogOverflowPolicy::Drop == m_Spec.Overflow || !m_Running.load(std::memory_order_relaxed))
+            {
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                ring.Dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            m_Wake.notify_one();
+            std::this_thread::yield();
+        }
+
+        if (padding)
+        {
+            LogRecordHeader header{};
+            header.Size = padding;
+            header.Flags = PaddingRecordFlag;
+            memcpy(ring.Data.get() + offset, &header, sizeof(header));
+        }
+        nextHead = head + required;
+        return ring.Data.get() + ((head + padding) & (ring.Capacity - 1));
+    }
+
+    uint8_t* Logger::BeginDeferred(LogCategory category, LogLevel level, const char* format, uint32_t payloadSize,
+                                   LogRing*& ring, uint64_t& nextHead)
+    {
+        ring = GetThreadRing();
+        auto recordSize = AlignRecord(sizeof(LogRecordHeader) + sizeof(DeferredRecord) + payloadSize);
+        auto* record = Reserve(*ring, recordSize, nextHead);
+        if (!record) { return nullptr; }
+
+        LogRecordHeader header{};
+        header.Size = recordSize;
+        header.Level = level;
+        header.Flags = DeferredRecordFlag;
+        header.Category = category;
+        header.Timestamp = static_cast<int64_t>(Clock::Now());
+        memcpy(record, &header, sizeof(header));
+
+        DeferredRecord deferred{format, payloadSize, 0};
+        memcpy(record + sizeof(header), &deferred, sizeof(deferred));
+        return record + sizeof(header) + sizeof(deferred);
+    }
+
+    void Logger::Commit(LogRing& ring, uint64_t nextHead) { ring.Head.store(nextHead, std::memory_order_release); }
+
+    void Logger::Push(LogCategory category, LogLevel level, const char* format, va_list args)
+    {
+        auto* ring = GetThreadRing();
+
+        char local[256];
+        va_list copy;
+        va_copy(copy, args);
+        auto length = vsnprintf(local, sizeof(local), format, copy);
+        va_end(copy);
+        if (length < 0) { return; }
+
+        auto textSize = std::min<uint32_t>(length, ring->Capacity / 2 - sizeof(LogRecordHeader) - 1);
+        auto recordSize = AlignRecord(sizeof(LogRecordHeader) + textSize + 1);
+        uint64_t nextHead;
+        auto* record = Reserve(*ring, recordSize, nextHead);
+        if (!record) { return; }
+
+        LogRecordHeader header{};
+        header.Size = recordSize;
+        header.Level = level;
+        header.Category = category;
+        header.Timestamp = static_cast<int64_t>(Clock::Now());
+        memcpy(record, &header, sizeof(header));
+
+        auto* text = reinterpret_cast<char*>(record + sizeof(header));
+        if (textSize < sizeof(local)) { memcpy(text, local, textSize + 1); }
+        else { vsnprintf(text, textSize + 1, format, args); }
+        text[textSize] = '\0';
+
+        ring->Head.store(nextHead, std::memory_order_release);
+    }
+
+    void Logger::Drain(bool fromCrash)
+    {
+        std::unique_lock drainLock(m_DrainMutex, std::defer_lock);
+        std::unique_lock ringsLock(m_RingsMutex, std::defer_lock);
+        if (fromCrash)
+        {
+            // Another thread holding a lock is draining or adding a ring right now, the batches and the ring list
+            // are its to touch. Waiting could deadlock, so the crash path only pushes out what stdio has buffered.
+            if (!drainLock.try_lock() || !ringsLock.try_lock())
+            {
+                if (m_File) { fflush(m_File); }
+                if (m_BinaryFile) { fflush(m_BinaryFile); }
+                return;
+            }
+        }
+        else
+        {
+            drainLock.lock();
+            ringsLock.lock();
+        }
+
+        m_DrainRings.clear();
+        m_DrainEnds.clear();
+        m_DrainRecords.clear();
+        for (auto& ring: m_Rings)
+        {
+            auto head = ring->Head.load(std::memory_order_acquire);
+            auto position = ring->Tail.load(std::memory_order_relaxed);
+            while (position < head)
+            {
+                const auto* record = ring->Data.get() + (position & (ring->Capacity - 1));
+                LogRecordHeader header;
+                memcpy(&header, record, sizeof(header));
+                if (!(header.Flags & PaddingRecordFlag)) { m_DrainRecords.push_back(record); }
+                position += header.Size;
+            }
+            m_DrainRings.push_back(ring.get());
+            m_DrainEnds.push_back(head);
+        }
+        ringsLock.unlock();
+
+        // Each ring is ordered already, merging by timestamp interleaves threads the way the calls happened.
+        std::stable_sort(m_DrainRecords.begin(), m_DrainRecords.end(), [](const uint8_t* a, const uint8_t* b) {
+            LogRecordHeader left, right;
+            memcpy(&left, a, sizeof(left));
+            memcpy(&right, b, sizeof(right));
+            return left.Timestamp < right.Timestamp;
+        });
+
+        m_Batch.clear();
+        m_BinaryBatch.clear();
+        const bool formatText = m_Spec.Console || m_File;
+        for (const auto* record: m_DrainRecords)
+        {
+            LogRecordHeader header;
+            memcpy(&header, record, sizeof(header));
+            const auto* body = record + sizeof(header);
+
+            DeferredRecord deferred{};
+            BufferView payload;
+            std::string_view text;
+            if (header.Flags & DeferredRecordFlag)
+            {
+                memcpy(&deferred, body, sizeof(deferred));
+                payload = {body + sizeof(deferred), deferred.PayloadSize};
+            }
+            else { text = reinterpret_cast<const char*>(body); }
+
+            if (formatText)
+            {
+                AppendPrefix(m_Batch, header.Category, header.Level);
+                if (deferred.Format) { LogFormat::Format(m_Batch, deferred.Format, payload); }
+                else { m_Batch.append(text); }
+            }
+
+            if (m_BinaryFile)
+            {
+                if (deferred.Format)
+                {
+                    // Formats are written once per file, messages refer to them by index.
+                    auto [site, inserted] =
+                            m_BinarySites.try_emplace(deferred.Format, static_cast<uint32_t>(m_BinarySites.size()));
+                    if (inserted)
+                    {
+                        auto length = static_cast<uint32_t>(strlen(deferred.Format));
+                        AppendBinary(m_BinaryBatch, LogFileFormat::Entry::Site);
+                        AppendBinary(m_BinaryBatch, site->second);
+                        AppendBinary(m_BinaryBatch, length);
+                        m_BinaryBatch.append(deferred.Format, length);
+                    }
+                    AppendBinary(m_BinaryBatch, LogFileFormat::Entry::Message);
+                    AppendBinary(m_BinaryBatch, header.Level);
+                    AppendBinary(m_BinaryBatch, header.Category);
+                    AppendBinary(m_BinaryBatch, ToNanoseconds(header.Timestamp));
+                    AppendBinary(m_BinaryBatch, site->second);
+                    AppendBinary(m_BinaryBatch, payload.GetSize());
+                    m_BinaryBatch.append(reinterpret_cast<const char*>(payload.Data()), payload.GetSize());
+                }
+                else
+                {
+                    AppendBinary(m_BinaryBatch, LogFileFormat::Entry::Text);
+                    AppendBinary(m_BinaryBatch, header.Level);
+                    AppendBinary(m_BinaryBatch, header.Category);
+                    AppendBinary(m_BinaryBatch, ToNanoseconds(header.Timestamp));
+                    AppendBinary(m_BinaryBatch, static_cast<uint32_t>(text.size()));
+                    m_BinaryBatch.append(text);
+                }
+            }
+        }
+
+        for (auto& ring: m_DrainRings)
+        {
+            auto dropped = ring->Dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped)
+            {
+                char message[96];
+                snprintf(message, sizeof(message), "[WARNING] %llu log messages dropped, the ring was full\n",
+                         static_cast<unsigned long long>(dropped));
+                m_Batch.append(message);
+            }
+        }
+
+        if (!m_Batch.empty())
+        {
+            if (m_Spec.Console)
+            {
+                fwrite(m_Batch.data(), 1, m_Batch.size(), stdout);
+                fflush(stdout);
+            }
+            if (m_File)
+            {
+                fwrite(m_Batch.data(), 1, m_Batch.size(), m_File);
+                fflush(m_File);
+            }
+        }
+        if (m_BinaryFile && !m_BinaryBatch.empty())
+        {
+            fwrite(m_BinaryBatch.data(), 1, m_BinaryBatch.size(), m_BinaryFile);
+            fflush(m_BinaryFile);
+        }
+
+        for (size_t i = 0; i < m_DrainRings.size(); i++)
+        {
+            m_DrainRings[i]->Tail.store(m_DrainEnds[i], std::memory_order_release);
+        }
+
+        if (!fromCrash)
+        {
+            // Rings of exited threads go away once everything they wrote is out.
+            std::lock_guard lock(m_RingsMutex);
+            std::erase_if(m_Rings, [](const std::shared_ptr<LogRing>& ring) {
+                return ring->Abandoned.load(std::memory_order_acquire) &&
+                       ring->Tail.load(std::memory_order_relaxed) == ring->Head.load(std::memory_order_acquire);
+            });
+        }
+    }
+
+    void Logger::WriterLoop()
+    {
+        while (m_Running.load(std::memory_order_acquire))
+        {
+            {
+                std::unique_lock lock(m_WakeMutex);
+                m_Wake.wait_for(lock, std::chrono::milliseconds(m_Spec.FlushIntervalMs),
+                                [this]() { return !m_Running.load(std::memory_order_acquire); });
+            }
+            Drain();
+        }
+    }
 #endif
 }// namespace Engine
\ No newline at end of file
@@ -1,15 +1,154 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdio.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <Core/LogFormat.hpp>
 
 namespace Engine
 {
+    enum class LogLevel : uint8_t
+    {
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Memory
+    };
+
+    /** Bit i of ENGINE_LOG_CATEGORY_MASK compiles category i in, see IsLogCompiled(). */
+    enum class LogCategory : uint8_t
+    {
+        General,
+        Memory,
+        Renderer,
+        Window,
+        Layer,
+        Count
+    };
+
+    inline constexpr size_t LogCategoryCount = static_cast<size_t>(LogCategory::Count);
+
+    inline constexpr const char* LogCategoryToString(LogCategory category)
+    {
+        switch (category)
+        {
+            case LogCategory::General:
+                return "General";
+            case LogCategory::Memory:
+                return "Memory";
+            case LogCategory::Renderer:
+                return "Renderer";
+            case LogCategory::Window:
+                return "Window";
+            case LogCategory::Layer:
+                return "Layer";
+            default:
+                return "Unknown";
+        }
+    }
+
+#ifndef ENGINE_LOG_CATEGORY_MASK
+#define ENGINE_LOG_CATEGORY_MASK 0xFFFFFFFF
+#endif
+
+    /** Warnings and errors are always compiled in, the other levels follow the ENGINE_ENABLE_*_LOG macros. */
+    inline constexpr uint32_t LogCompiledLevels = (1u << static_cast<uint32_t>(LogLevel::Warning)) |
+                                                  (1u << static_cast<uint32_t>(LogLevel::Error))
+#ifdef ENGINE_ENABLE_DEBUG_LOG
+                                                  | (1u << static_cast<uint32_t>(LogLevel::Debug))
+#endif
+#ifdef ENGINE_ENABLE_VERBOSE_LOG
+                                                  | (1u << static_cast<uint32_t>(LogLevel::Info))
+#endif
+#ifdef ENGINE_ENABLE_MEMORY_DEBUG_LOG
+                                                  | (1u << static_cast<uint32_t>(LogLevel::Memory))
+#endif
+            ;
+
+    /** Sites that are not compiled in generate no code and do not evaluate their arguments. */
+    inline constexpr bool IsLogCompiled(LogCategory category, LogLevel level)
+    {
+        return (static_cast<uint32_t>(ENGINE_LOG_CATEGORY_MASK) & (1u << static_cast<uint32_t>(category))) &&
+               (LogCompiledLevels & (1u << static_cast<uint32_t>(level)));
+    }
+
+    /**
+     * Per site state of LOG_RATE_LIMITED, lets through at most a given number of messages per second and counts the
+     * rest. The count is reported with the first message of the next second, a site that goes quiet does not report.
+     */
+    class LogRateLimiter
+    {
+    public:
+        /** suppressed is set to the messages dropped since the last one that got through. */
+        bool Allow(uint32_t perSecond, uint64_t& suppressed);
+
+    private:
+        std::atomic<int64_t> m_WindowStart{};
+        std::atomic<uint32_t> m_Count{};
+        std::atomic<uint64_t> m_Suppressed{};
+    };
+
+    /** Per site state of LOG_ONCE. */
+    class LogOnceFlag
+    {
+    public:
+        bool Set()
+        {
+            return !m_Set.load(std::memory_order_relaxed) && !m_Set.exchange(true, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<bool> m_Set{};
+    };
+
+    enum class LogOverflowPolicy
+    {
+        /** Messages that do not fit into the thread's ring are counted and dropped. */
+        Drop,
+        /** The logging thread waits for the writer to make room. */
+        Block
+    };
+
+    struct LoggerSpec {
+        /** Per thread, rounded up to a power of two. */
+        uint32_t RingSize = 256 * 1024;
+        LogOverflowPolicy Overflow = LogOverflowPolicy::Drop;
+        uint32_t FlushIntervalMs = 2;
+        bool Console = true;
+        /** Also appended to this file when set. */
+        std::string FilePath;
+        /** Unformatted records are appended to this file when set, expand it with the LogDecoder tool. */
+        std::string BinaryFilePath;
+        /** Flush pending messages on fatal signals before the process dies. */
+        bool FlushOnCrash = true;
+    };
+
+    struct LogRing;
+
+    /**
+     * Asynchronous log backend.
+     *
+     * Every logging thread formats into its own single producer ring, so a log call never takes a lock or touches
+     * the terminal. A writer thread drains all rings in timestamp order and writes them in batches. Before Create()
+     * and after Shutdown() messages are written synchronously. Pending messages are flushed on Shutdown(), at exit
+     * and, with FlushOnCrash, on fatal signals.
+     */
     class Logger
     {
     public:
-        Logger() { Init(); }
+        Logger(const LoggerSpec& spec = {}) : m_Spec(spec) { Init(); }
 
         ~Logger() { Destroy(); };
 
@@ -18,20 +157,136 @@ namespace Engine
         void Destroy();
 
     public:
-        static void Create();
+        static void Create(const LoggerSpec& spec = {});
+
+        /** Flushes and stops the writer, logging falls back to synchronous writes. */
+        static void Shutdown();
 
         static Logger* GetInstance();
+
+        static void Write(LogLevel level, const char* format, ...);
+
+        static void Write(LogCategory category, LogLevel level, const char* format, ...);
+
+        static void WriteV(LogLevel level, const char* format, va_list args);
+
+        static void WriteV(LogCategory category, LogLevel level, const char* format, va_list args);
+
+        /** Only encodes the arguments, the text is formatted on the writer thread or by the LogDecoder tool. */
+        template <typename... Args>
+        static void WriteFormat(LogCategory category, LogLevel level,
+                                const LogFormatString<std::type_identity_t<Args>...>& format, const Args&... args);
+
+        /** Summary written by LOG_RATE_LIMITED for the messages it dropped. */
+        static void WriteSuppressed(LogCategory category, LogLevel level, uint64_t count, const char* file, int line);
+
+        /** Runtime filter on top of IsLogCompiled(), Debug and Memory rank lowest. Everything is enabled by default. */
+        static void SetCategoryLevel(LogCategory category, LogLevel minLevel);
+
+        static bool IsEnabled(LogCategory category, LogLevel level)
+        {
+            return !(s_DisabledLevels[static_cast<size_t>(category)].load(std::memory_order_relaxed) &
+                     (1u << static_cast<uint32_t>(level)));
+        }
+
+        /** Writes everything logged so far before returning. */
+        static void Flush();
+
+        static uint64_t GetDroppedCount();
+
+        static const char* GetLevelPrefix(LogLevel level);
+
+        /** Level prefix followed by the category, General is left out. */
+        static void AppendPrefix(std::string& output, LogCategory category, LogLevel level);
+
+        /**
+         * Best effort flush for fatal signal handlers, does not wait for locks the crashing thread may hold. When
+         * another thread is draining, only the files are flushed and the messages still in the rings are lost.
+         */
+        static void FlushFromCrash();
+
 #ifdef LWLOG
         std::shared_ptr<lwlog::logger<lwlog::default_log_policy, lwlog::default_storage_policy,
                                       lwlog::single_threaded_policy, lwlog::sinks::stdout_sink>>
                 console;
 #endif
+    private:
+        /**
+         * Loads s_Instance and keeps it alive for the scope. Shutdown() clears s_Instance and then waits for every
+         * scope that may have seen the old value, so nothing pushes into a logger that is drained for the last time
+         * or freed.
+         */
+        class InstanceScope
+        {
+        public:
+            InstanceScope();
+            ~InstanceScope();
+
+            InstanceScope(const InstanceScope&) = delete;
+            InstanceScope& operator=(const InstanceScope&) = delete;
+
+            Logger* Get() const { return m_Logger; }
+
+        private:
+            std::atomic<uint32_t>* m_Users;
+            Logger* m_Logger;
+        };
+
+        static void WriteDirect(LogCategory category, LogLevel level, const char* format, va_list args);
+
+        /** Formats an encoded message right away, used before Create() and for oversized payloads. */
+        static void WriteEncoded(LogCategory category, LogLevel level, const char* format, BufferView payload);
+
+        /** Returns nullptr when the record is dropped, Commit() publishes it. */
+        uint8_t* BeginDeferred(LogCategory category, LogLevel level, const char* format, uint32_t payloadSize,
+                               LogRing*& ring, uint64_t& nextHead);
+
+        static void Commit(LogRing& ring, uint64_t nextHead);
+
+        LogRing* GetThreadRing();
+
+        /** Returns nullptr when the record is dropped, nextHead publishes it. */
+        uint8_t* Reserve(LogRing& ring, uint32_t size, uint64_t& nextHead);
+
+        void Push(LogCategory category, LogLevel level, const char* format, va_list args);
+
+        void Drain(bool fromCrash = false);
+
+        void WriterLoop();
+
     private:
         static std::shared_ptr<Logger> s_Logger;
+        static std::atomic<Logger*> s_Instance;
+        static std::atomic<uint8_t> s_DisabledLevels[LogCategoryCount];
+
+        LoggerSpec m_Spec;
+        uint32_t m_RingSize{};
+        uint32_t m_MaxPayloadSize{};
+        uint64_t m_Generation{};
+        std::atomic<bool> m_Running{};
+        std::thread m_Writer;
+        std::mutex m_WakeMutex;
+        std::condition_variable m_Wake;
+
+        std::mutex m_RingsMutex;
+        std::vector<std::shared_ptr<LogRing>> m_Rings;
+
+        /** Held while draining, the writer thread and Flush() never consume at the same time. */
+        std::recursive_mutex m_DrainMutex;
+        std::vector<LogRing*> m_DrainRings;
+        std::vector<uint64_t> m_DrainEnds;
+        std::vector<const uint8_t*> m_DrainRecords;
+        std::string m_Batch;
+        std::string m_BinaryBatch;
+        std::unordered_map<const char*, uint32_t> m_BinarySites;
+        FILE* m_BinaryFile{};
+        std::atomic<uint64_t> m_Dropped{};
+        FILE* m_File{};
     };
 
 }// namespace Engine
 
+#include "Log.impl.hpp"
 
 #ifdef LWLOG
 #define LOG(...)                                                                                                       \
@@ -53,90 +308,60 @@ namespace Engine
     Engine::Logger::GetInstance()->console->critical(__VA_ARGS__);                                                     \
     std::flush(std::cout);
 #else
-#define LOG(...) printf_s(__VA_ARGS__)
-
-template <typename... Args>
-inline static void LOG_INFO(const char* format, Args... args)
-{
-#ifdef ENGINE_ENABLE_VERBOSE_LOG
-    LOG("[INFO] ");
-    LOG(format, args...);
-#endif
-}
+#define LOG(...) Engine::Logger::Write(Engine::LogLevel::Info, __VA_ARGS__)
 
-template <typename T>
-inline static void LOG_INFO(const T* format)
-{
-#ifdef ENGINE_ENABLE_VERBOSE_LOG
-    LOG("[INFO] ");
-    LOG("%s", format);
-#endif
-}
+// Formats are checked against the arguments at compile time, runtime text is logged with "%s". Sites compiled out by
+// IsLogCompiled() or filtered by Logger::SetCategoryLevel() do not evaluate their arguments.
 
-template <typename... Args>
-inline static void LOG_DEBUG(const char* format, Args... args)
-{
-#ifdef ENGINE_ENABLE_DEBUG_LOG
-    LOG("[DEBUG] ");
-    LOG(format, args...);
-#endif
-}
+#define LOG_CATEGORY(category, level, ...)                                                                             \
+    do {                                                                                                               \
+        if constexpr (Engine::IsLogCompiled(Engine::LogCategory::category, Engine::LogLevel::level))                  \
+        {                                                                                                              \
+            if (Engine::Logger::IsEnabled(Engine::LogCategory::category, Engine::LogLevel::level))                     \
+            {                                                                                                          \
+                Engine::Logger::WriteFormat(Engine::LogCategory::category, Engine::LogLevel::level, __VA_ARGS__);      \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (0)
 
-inline static void LOG_DEBUG(const char* format)
-{
-#ifdef ENGINE_ENABLE_DEBUG_LOG
-    LOG("[DEBUG] ");
-    LOG(format);
-#endif
-}
-
-template <typename... Args>
-inline static void LOG_ERROR(const char* format, Args... args)
-{
-    LOG("[ERROR] ");
-    LOG(format, args...);
-}
+/** At most perSecond messages per second from this site, the number dropped is reported after the next one. */
+#define LOG_RATE_LIMITED(category, level, perSecond, ...)                                                              \
+    do {                                                                                                               \
+        if constexpr (Engine::IsLogCompiled(Engine::LogCategory::category, Engine::LogLevel::level))                  \
+        {                                                                                                              \
+            static Engine::LogRateLimiter logRateLimiter;                                                              \
+            uint64_t logSuppressed;                                                                                    \
+            if (Engine::Logger::IsEnabled(Engine::LogCategory::category, Engine::LogLevel::level) &&                   \
+                logRateLimiter.Allow(perSecond, logSuppressed))                                                        \
+            {                                                                                                          \
+                Engine::Logger::WriteFormat(Engine::LogCategory::category, Engine::LogLevel::level, __VA_ARGS__);      \
+                if (logSuppressed)                                                                                     \
+                {                                                                                                      \
+                    Engine::Logger::WriteSuppressed(Engine::LogCategory::category, Engine::LogLevel::level,            \
+                                                    logSuppressed, __FILE__, __LINE__);                                \
+                }                                                                                                      \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (0)
 
-inline static void LOG_ERROR(std::string_view format)
-{
-    LOG("[ERROR] ");
-    LOG(format.data());
-}
+/** Only the first message from this site is written. */
+#define LOG_ONCE(category, level, ...)                                                                                 \
+    do {                                                                                                               \
+        if constexpr (Engine::IsLogCompiled(Engine::LogCategory::category, Engine::LogLevel::level))                  \
+        {                                                                                                              \
+            static Engine::LogOnceFlag logOnceFlag;                                                                    \
+            if (Engine::Logger::IsEnabled(Engine::LogCategory::category, Engine::LogLevel::level) &&                   \
+                logOnceFlag.Set())                                                                                     \
+            {                                                                                                          \
+                Engine::Logger::WriteFormat(Engine::LogCategory::category, Engine::LogLevel::level, __VA_ARGS__);      \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (0)
 
-inline static void LOG_ERROR(const std::string& format)
-{
-    LOG("[ERROR] ");
-    LOG(format.c_str());
-}
-
-template <typename... Args>
-inline static void LOG_WARNING(const char* format, Args... args)
-{
-    LOG("[WARNING] ");
-    LOG(format, args...);
-}
-
-inline static void LOG_WARNING(const char* format)
-{
-    LOG("[WARNING] ");
-    LOG(format);
-}
-
-template <typename... Args>
-inline static void LOG_MEMORY_ALLOC(const char* format, Args... args)
-{
-#ifdef ENGINE_ENABLE_MEMORY_DEBUG_LOG
-    LOG("[MEMORY] ");
-    LOG(format, args...);
-#endif
-}
-
-inline static void LOG_MEMORY_ALLOC(const char* format)
-{
-#ifdef ENGINE_ENABLE_MEMORY_DEBUG_LOG
-    LOG("[MEMORY] ");
-    LOG(format);
-#endif
-}
+#define LOG_INFO(...) LOG_CATEGORY(General, Info, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_CATEGORY(General, Debug, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_CATEGORY(General, Error, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_CATEGORY(General, Warning, __VA_ARGS__)
+#define LOG_MEMORY_ALLOC(...) LOG_CATEGORY(Memory, Memory, __VA_ARGS__)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * Logger templated functions implementation
+ */
+
+#include "Log.hpp"
+
+namespace Engine
+{
+    template <typename... Args>
+    void Logger::WriteFormat(LogCategory category, LogLevel level,
+                             const LogFormatString<std::type_identity_t<Args>...>& format, const Args&... args)
+    {
+        const auto payloadSize = LogFormat::GetEncodedSize(format.GetTypes(), args...);
+
+        InstanceScope instance;
+        auto* logger = instance.Get();
+        if (logger && logger->m_Running.load(std::memory_order_relaxed) && payloadSize <= logger->m_MaxPayloadSize)
+        {
+            LogRing* ring;
+            uint64_t nextHead;
+            if (auto* payload =
+                        logger->BeginDeferred(category, level, format.GetFormat(), payloadSize, ring, nextHead))
+            {
+                LogFormat::Encode(payload, format.GetTypes(), args...);
+                Commit(*ring, nextHead);
+            }
+            return;
+        }
+
+        uint8_t local[512];
+        std::unique_ptr<uint8_t[]> heap;
+        auto* payload = local;
+        if (payloadSize > sizeof(local))
+        {
+            heap.reset(new uint8_t[payloadSize]);
+            payload = heap.get();
+        }
+        LogFormat::Encode(payload, format.GetTypes(), args...);
+        WriteEncoded(category, level, format.GetFormat(), {payload, payloadSize});
+    }
+}// namespace Engine
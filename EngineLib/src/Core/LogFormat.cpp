@@ -0,0 +1,246 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * LogFormat class implementation
+ */
+
+#include "LogFormat.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr int64_t MaxWidth = 4096;
+
+        class PayloadReader
+        {
+        public:
+            explicit PayloadReader(BufferView payload) : m_Payload(payload) {}
+
+            bool ReadType(LogArgType& type)
+            {
+                if (m_Offset + 1 > m_Payload.GetSize()) { return false; }
+                type = static_cast<LogArgType>(m_Payload[m_Offset++]);
+                return type <= LogArgType::String;
+            }
+
+            bool ReadBits(uint64_t& bits)
+            {
+                if (m_Offset + sizeof(bits) > m_Payload.GetSize()) { return false; }
+                bits = m_Payload.Read<uint64_t>(m_Offset);
+                m_Offset += sizeof(bits);
+                return true;
+            }
+
+            bool ReadString(std::string_view& text)
+            {
+                if (m_Offset + sizeof(uint32_t) > m_Payload.GetSize()) { return false; }
+                auto size = m_Payload.Read<uint32_t>(m_Offset);
+                m_Offset += sizeof(uint32_t);
+                if (size > m_Payload.GetSize() - m_Offset) { return false; }
+                text = {reinterpret_cast<const char*>(m_Payload.Data() + m_Offset), size};
+                m_Offset += size;
+                return true;
+            }
+
+        private:
+            BufferView m_Payload;
+            uint32_t m_Offset{};
+        };
+
+        bool IsConversionOf(LogArgType type, char conversion)
+        {
+            switch (type)
+            {
+                case LogArgType::Int:
+                case LogArgType::UInt:
+                    return strchr("dicuoxX", conversion);
+                case LogArgType::Double:
+                    return strchr("fFeEgGaA", conversion);
+                case LogArgType::Pointer:
+                    return 'p' == conversion;
+                case LogArgType::String:
+                    return 's' == conversion;
+                default:
+                    return false;
+            }
+        }
+
+        template <typename... Args>
+        void AppendFormatted(std::string& output, const char* spec, Args... args)
+        {
+            char local[256];
+            auto length = snprintf(local, sizeof(local), spec, args...);
+            if (length < 0) { return; }
+            if (static_cast<size_t>(length) < sizeof(local))
+            {
+                output.append(local, length);
+                return;
+            }
+            auto offset = output.size();
+            output.resize(offset + length + 1);
+            snprintf(output.data() + offset, length + 1, spec, args...);
+            output.resize(offset + length);
+        }
+    }// namespace
+
+    void LogFormat::Format(std::string& output, const char* format, BufferView payload)
+    {
+        PayloadReader reader(payload);
+        const char* p = format;
+
+        while (*p)
+        {
+            const char* literal = p;
+            while (*p && '%' != *p) { p++; }
+            output.append(literal, p - literal);
+            if (!*p) { break; }
+
+            p++;
+            if ('%' == *p)
+            {
+                output.push_back('%');
+                p++;
+                continue;
+            }
+
+            // Rebuild the conversion with '*' replaced by the recorded values and the length modifier matching the
+            // widened argument.
+            char spec[64];
+            size_t length = 0;
+            spec[length++] = '%';
+            while ((*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') && length < 8)
+            {
+                spec[length++] = *p++;
+            }
+
+            LogArgType type;
+            uint64_t bits;
+            auto readNumber = [&](bool& present, int64_t& value) {
+                present = false;
+                if ('*' == *p)
+                {
+                    p++;
+                    if (!reader.ReadType(type) || !reader.ReadBits(bits)) { return false; }
+                    value = static_cast<int64_t>(bits);
+                    present = true;
+                }
+                else if (*p >= '0' && *p <= '9')
+                {
+                    value = 0;
+                    while (*p >= '0' && *p <= '9') { value = value * 10 + (*p++ - '0'); }
+                    present = true;
+                }
+                return true;
+            };
+
+            bool hasWidth, hasPrecision = false;
+            int64_t width = 0, precision = 0;
+            if (!readNumber(hasWidth, width))
+            {
+                output.append("<corrupt>");
+                return;
+            }
+            if ('.' == *p)
+            {
+                p++;
+                if (!readNumber(hasPrecision, precision))
+                {
+                    output.append("<corrupt>");
+                    return;
+                }
+                // A lone '.' means precision 0, a negative '*' precision means none.
+                if (!hasPrecision) { hasPrecision = true; }
+                if (precision < 0) { hasPrecision = false; }
+            }
+            if (hasWidth)
+            {
+                if (width < 0)
+                {
+                    spec[length++] = '-';
+                    width = -width;
+                }
+                length += snprintf(spec + length, sizeof(spec) - length, "%d",
+                                   static_cast<int>(std::min<int64_t>(width, MaxWidth)));
+            }
+
+            while (*p == 'h' || *p == 'l' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'L') { p++; }
+            auto conversion = *p;
+            if (!conversion) { break; }
+            p++;
+
+            if (!reader.ReadType(type) || !IsConversionOf(type, conversion))
+            {
+                output.append("<corrupt>");
+                return;
+            }
+
+            if (LogArgType::String == type)
+            {
+                std::string_view text;
+                if (!reader.ReadString(text))
+                {
+                    output.append("<corrupt>");
+                    return;
+                }
+                auto size = hasPrecision ? std::min<size_t>(precision, text.size()) : text.size();
+                snprintf(spec + length, sizeof(spec) - length, ".*s");
+                AppendFormatted(output, spec, static_cast<int>(size), text.data());
+                continue;
+            }
+
+            if (!reader.ReadBits(bits))
+            {
+                output.append("<corrupt>");
+                return;
+            }
+            if (hasPrecision)
+            {
+                length += snprintf(spec + length, sizeof(spec) - length, ".%d",
+                                   static_cast<int>(std::min<int64_t>(precision, MaxWidth)));
+            }
+
+            switch (type)
+            {
+                case LogArgType::Int:
+                    if ('c' == conversion)
+                    {
+                        snprintf(spec + length, sizeof(spec) - length, "c");
+                        AppendFormatted(output, spec, static_cast<int>(bits));
+                    }
+                    else
+                    {
+                        snprintf(spec + length, sizeof(spec) - length, "ll%c", 'i' == conversion ? 'd' : conversion);
+                        AppendFormatted(output, spec, static_cast<long long>(bits));
+                    }
+                    break;
+                case LogArgType::UInt:
+                    snprintf(spec + length, sizeof(spec) - length, "ll%c", conversion);
+                    AppendFormatted(output, spec, static_cast<unsigned long long>(bits));
+                    break;
+                case LogArgType::Double:
+                {
+                    double number;
+                    memcpy(&number, &bits, sizeof(number));
+                    snprintf(spec + length, sizeof(spec) - length, "%c", conversion);
+                    AppendFormatted(output, spec, number);
+                    break;
+                }
+                case LogArgType::Pointer:
+                    snprintf(spec + length, sizeof(spec) - length, "p");
+                    AppendFormatted(output, spec, reinterpret_cast<void*>(static_cast<uintptr_t>(bits)));
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}// namespace Engine
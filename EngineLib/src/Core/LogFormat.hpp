@@ -0,0 +1,125 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * LogFormat class definition
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <Core/BufferView.hpp>
+
+namespace Engine
+{
+    /** Tag stored in front of every deferred argument. */
+    enum class LogArgType : uint8_t
+    {
+        Int,
+        UInt,
+        Double,
+        Pointer,
+        String
+    };
+
+    /** Layout of binary log files, expanded by the LogDecoder tool. */
+    struct LogFileFormat {
+        static constexpr uint32_t Magic = 0x474F4C45;// "ELOG"
+        static constexpr uint32_t Version = 2;
+
+        enum class Entry : uint8_t
+        {
+            /** u32 site id, u32 length, format text. */
+            Site = 1,
+            /** u8 level, u8 category (version 2), i64 timestamp in ns, u32 site id, u32 payload size, payload. */
+            Message = 2,
+            /** u8 level, u8 category (version 2), i64 timestamp in ns, u32 length, text. */
+            Text = 3
+        };
+    };
+
+    /**
+     * Deferred printf style formatting: the logging thread only encodes its arguments, the text is built later on the
+     * writer thread or offline from a binary log. Strings are copied into the payload, everything else is widened
+     * to 64 bits.
+     */
+    class LogFormat
+    {
+    public:
+        template <typename T>
+        static constexpr bool IsString =
+                std::is_same_v<std::decay_t<T>, char*> || std::is_same_v<std::decay_t<T>, const char*> ||
+                std::is_same_v<std::remove_cvref_t<T>, std::string> ||
+                std::is_same_v<std::remove_cvref_t<T>, std::string_view>;
+
+        template <typename T>
+        static constexpr bool IsInteger = std::is_integral_v<std::remove_cvref_t<T>> ||
+                                          std::is_enum_v<std::remove_cvref_t<T>>;
+
+        template <typename T>
+        static constexpr bool IsFloat = std::is_floating_point_v<std::remove_cvref_t<T>>;
+
+        template <typename T>
+        static constexpr bool IsPointer = std::is_pointer_v<std::decay_t<T>> ||
+                                          std::is_null_pointer_v<std::remove_cvref_t<T>>;
+
+    public:
+        template <typename... Args>
+        static uint32_t GetEncodedSize(const LogArgType* types, const Args&... args);
+
+        template <typename... Args>
+        static void Encode(uint8_t* output, const LogArgType* types, const Args&... args);
+
+        /** Appends the formatted text, a payload that does not match the format ends the text with <corrupt>. */
+        static void Format(std::string& output, const char* format, BufferView payload);
+
+    private:
+        template <typename T>
+        static uint32_t GetArgSize(LogArgType type, const T& value);
+
+        template <typename T>
+        static void EncodeArg(uint8_t*& output, LogArgType type, const T& value);
+
+        template <typename T>
+        static std::string_view ToStringView(const T& value);
+    };
+
+    /** Not constexpr on purpose, reaching it during constant evaluation turns the message into a compile error. */
+    inline void LogFormatError(const char*) {}
+
+    /**
+     * printf format string checked against its argument types at compile time, the way std::format_string is.
+     * Conversions have to match the kind of argument (integer, floating point, string, pointer), the argument count
+     * has to match and %n is rejected.
+     */
+    template <typename... Args>
+    class LogFormatString
+    {
+    public:
+        consteval LogFormatString(const char* format) : m_Format(format) { Parse(); }
+
+    public:
+        const char* GetFormat() const { return m_Format; }
+
+        const LogArgType* GetTypes() const { return m_Types.data(); }
+
+    private:
+        consteval void Parse();
+
+    private:
+        const char* m_Format;
+        std::array<LogArgType, sizeof...(Args)> m_Types{};
+    };
+}// namespace Engine
+
+#include "LogFormat.impl.hpp"
@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * LogFormat templated functions implementation
+ */
+
+#include "LogFormat.hpp"
+
+namespace Engine
+{
+    template <typename... Args>
+    uint32_t LogFormat::GetEncodedSize(const LogArgType* types, const Args&... args)
+    {
+        uint32_t size = 0;
+        uint32_t index = 0;
+        ((size += GetArgSize(types[index++], args)), ...);
+        return size;
+    }
+
+    template <typename... Args>
+    void LogFormat::Encode(uint8_t* output, const LogArgType* types, const Args&... args)
+    {
+        uint32_t index = 0;
+        (EncodeArg(output, types[index++], args), ...);
+    }
+
+    template <typename T>
+    uint32_t LogFormat::GetArgSize(LogArgType type, const T& value)
+    {
+        if constexpr (IsString<T>)
+        {
+            if (LogArgType::String == type)
+            {
+                return sizeof(LogArgType) + sizeof(uint32_t) + static_cast<uint32_t>(ToStringView(value).size());
+            }
+        }
+        return sizeof(LogArgType) + sizeof(uint64_t);
+    }
+
+    template <typename T>
+    void LogFormat::EncodeArg(uint8_t*& output, LogArgType type, const T& value)
+    {
+        using Type = std::remove_cvref_t<T>;
+        *output++ = static_cast<uint8_t>(type);
+
+        uint64_t bits = 0;
+        if constexpr (IsString<T>)
+        {
+            if (LogArgType::String == type)
+            {
+                auto text = ToStringView(value);
+                auto size = static_cast<uint32_t>(text.size());
+                memcpy(output, &size, sizeof(size));
+                memcpy(output + sizeof(size), text.data(), size);
+                output += sizeof(size) + size;
+                return;
+            }
+            if constexpr (std::is_pointer_v<std::decay_t<T>>)
+            {
+                bits = reinterpret_cast<uintptr_t>(static_cast<const void*>(value));
+            }
+        }
+        else if constexpr (IsFloat<T>)
+        {
+            auto number = static_cast<double>(value);
+            memcpy(&bits, &number, sizeof(bits));
+        }
+        else if constexpr (std::is_same_v<Type, bool>) { bits = value; }
+        else if constexpr (IsInteger<T>)
+        {
+            // Same width reinterpretation as printf, %u of -1 is 4294967295 and not 2^64 - 1.
+            using Integer = typename std::conditional_t<std::is_enum_v<Type>, std::underlying_type<Type>,
+                                                        std::type_identity<Type>>::type;
+            auto integer = static_cast<Integer>(value);
+            if (LogArgType::UInt == type) { bits = static_cast<std::make_unsigned_t<Integer>>(integer); }
+            else
+            {
+                auto widened = static_cast<int64_t>(static_cast<std::make_signed_t<Integer>>(integer));
+                bits = static_cast<uint64_t>(widened);
+            }
+        }
+        else if constexpr (std::is_pointer_v<std::decay_t<T>>)
+        {
+            bits = reinterpret_cast<uintptr_t>(static_cast<const void*>(value));
+        }
+
+        memcpy(output, &bits, sizeof(bits));
+        output += sizeof(bits);
+    }
+
+    template <typename T>
+    std::string_view LogFormat::ToStringView(const T& value)
+    {
+        if constexpr (std::is_pointer_v<std::decay_t<T>>)
+        {
+            // Arrays are usually fixed size buffers, stop at the terminator or the end of the array.
+            if constexpr (std::is_array_v<T>) { return {value, strnlen(value, std::extent_v<T>)}; }
+            else { return value ? std::string_view{value} : std::string_view{"(null)"}; }
+        }
+        else { return std::string_view{value}; }
+    }
+
+    template <typename... Args>
+    consteval void LogFormatString<Args...>::Parse()
+    {
+        constexpr size_t Count = sizeof...(Args);
+        constexpr bool IsInteger[] = {LogFormat::IsInteger<Args>..., false};
+        constexpr bool IsFloat[] = {LogFormat::IsFloat<Args>..., false};
+        constexpr bool IsString[] = {LogFormat::IsString<Args>..., false};
+        constexpr bool IsPointer[] = {LogFormat::IsPointer<Args>..., false};
+
+        size_t arg = 0;
+        auto takeStar = [&]() {
+            if (arg >= Count) { LogFormatError("Log format has more conversions than arguments"); }
+            if (!IsInteger[arg]) { LogFormatError("Log format '*' width or precision needs an integer argument"); }
+            m_Types[arg++] = LogArgType::Int;
+        };
+
+        const char* p = m_Format;
+        while (*p)
+        {
+            if ('%' != *p++) { continue; }
+            if ('%' == *p)
+            {
+                p++;
+                continue;
+            }
+
+            while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') { p++; }
+            if ('*' == *p)
+            {
+                takeStar();
+                p++;
+            }
+            while (*p >= '0' && *p <= '9') { p++; }
+            if ('.' == *p)
+            {
+                p++;
+                if ('*' == *p)
+                {
+                    takeStar();
+                    p++;
+                }
+                while (*p >= '0' && *p <= '9') { p++; }
+            }
+            while (*p == 'h' || *p == 'l' || *p == 'j' || *p == 'z' || *p == 't' || *p == 'L') { p++; }
+
+            auto conversion = *p;
+            if (!conversion) { LogFormatError("Log format ends inside a conversion"); }
+            p++;
+            if (arg >= Count) { LogFormatError("Log format has more conversions than arguments"); }
+
+            switch (conversion)
+            {
+                case 'd':
+                case 'i':
+                case 'c':
+                    if (!IsInteger[arg]) { LogFormatError("Log format %d, %i and %c need an integer argument"); }
+                    m_Types[arg] = LogArgType::Int;
+                    break;
+                case 'u':
+                case 'o':
+                case 'x':
+                case 'X':
+                    if (!IsInteger[arg]) { LogFormatError("Log format %u, %o, %x and %X need an integer argument"); }
+                    m_Types[arg] = LogArgType::UInt;
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A':
+                    if (!IsFloat[arg])
+                    {
+                        LogFormatError("Log format %f, %e, %g and %a need a floating point argument");
+                    }
+                    m_Types[arg] = LogArgType::Double;
+                    break;
+                case 's':
+                    if (!IsString[arg]) { LogFormatError("Log format %s needs a string argument"); }
+                    m_Types[arg] = LogArgType::String;
+                    break;
+                case 'p':
+                    if (!IsPointer[arg]) { LogFormatError("Log format %p needs a pointer argument"); }
+                    m_Types[arg] = LogArgType::Pointer;
+                    break;
+                default:
+                    LogFormatError("Log format has an unsupported conversion");
+                    break;
+            }
+            arg++;
+        }
+
+        if (arg != Count) { LogFormatError("Log format has fewer conversions than arguments"); }
+    }
+}// namespace Engine
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * MappedBuffer class implementation
+ */
+
+#ifdef _WIN32
+#include <Platform/WindowInstance.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedBuffer.hpp"
+#include <Core/Log.hpp>
+#include <Core/VirtualMemory.hpp>
+
+#include <algorithm>
+
+namespace Engine
+{
+    MappedBuffer::~MappedBuffer() { Close(); }
+
+    std::expected<MappedBufferState, ErrorStatus> MappedBuffer::Open(const std::filesystem::path& path,
+                                                                     MappedAccessHint hint)
+    {
+        Close();
+
+#ifdef _WIN32
+        auto flags = MappedAccessHint::Sequential == hint ? FILE_FLAG_SEQUENTIAL_SCAN
+                   : MappedAccessHint::Random == hint     ? FILE_FLAG_RANDOM_ACCESS
+                                                          : FILE_ATTRIBUTE_NORMAL;
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if (INVALID_HANDLE_VALUE == file)
+        {
+            LOG_ERROR("Can Not Open %s!\n", path.string().c_str());
+            return std::unexpected(ErrorStatus::CanNotOpenFile);
+        }
+
+        LARGE_INTEGER fileSize{};
+        GetFileSizeEx(file, &fileSize);
+        if (static_cast<uint64_t>(fileSize.QuadPart) > UINT32_MAX)
+        {
+            LOG_ERROR("Can Not Map %s, file is larger than 4 GiB!\n", path.string().c_str());
+            CloseHandle(file);
+            return std::unexpected(ErrorStatus::CanNotMapFile);
+        }
+
+        // Empty files can not be mapped, they stay an open empty view.
+        if (fileSize.QuadPart > 0)
+        {
+            auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            auto view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (nullptr == view)
+            {
+                LOG_ERROR("Can Not Map %s!\n", path.string().c_str());
+                if (mapping) { CloseHandle(mapping); }
+                CloseHandle(file);
+                return std::unexpected(ErrorStatus::CanNotMapFile);
+            }
+            m_MappingHandle = mapping;
+            m_Data = static_cast<const uint8_t*>(view);
+        }
+        m_FileHandle = file;
+        m_Size = static_cast<uint32_t>(fileSize.QuadPart);
+#else
+        auto file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            LOG_ERROR("Can Not Open %s!\n", path.c_str());
+            return std::unexpected(ErrorStatus::CanNotOpenFile);
+        }
+
+        struct stat fileStat {};
+        if (0 != fstat(file, &fileStat) || static_cast<uint64_t>(fileStat.st_size) > UINT32_MAX)
+        {
+            LOG_ERROR("Can Not Map %s, file is missing or larger than 4 GiB!\n", path.c_str());
+            close(file);
+            return std::unexpected(ErrorStatus::CanNotMapFile);
+        }
+
+        // Empty files can not be mapped, they stay an open empty view.
+        if (fileStat.st_size > 0)
+        {
+            auto view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (MAP_FAILED == view)
+            {
+                LOG_ERROR("Can Not Map %s!\n", path.c_str());
+                close(file);
+                return std::unexpected(ErrorStatus::CanNotMapFile);
+            }
+            m_Data = static_cast<const uint8_t*>(view);
+        }
+        // The mapping keeps the file referenced on its own.
+        close(file);
+        m_Size = static_cast<uint32_t>(fileStat.st_size);
+#endif
+
+        m_State = MappedBufferState::Mapped;
+        if (MappedAccessHint::Normal != hint) { Advise(hint); }
+        return m_State;
+    }
+
+    MappedBufferState MappedBuffer::Close()
+    {
+        StopPrefetch();
+        if (MappedBufferState::Closed == m_State) { return m_State; }
+
+#ifdef _WIN32
+        if (m_Data) { UnmapViewOfFile(m_Data); }
+        if (m_MappingHandle) { CloseHandle(m_MappingHandle); }
+        if (m_FileHandle) { CloseHandle(m_FileHandle); }
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+#else
+        if (m_Data) { munmap(const_cast<uint8_t*>(m_Data), m_Size); }
+#endif
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_State = MappedBufferState::Closed;
+        return m_State;
+    }
+
+    void MappedBuffer::Advise(MappedAccessHint hint, uint32_t offset, uint32_t size)
+    {
+        auto range = Slice(offset, size);
+        if (range.Empty()) { return; }
+
+        // Hints work on whole pages, round the start down to the page containing it.
+        auto pageSize = VirtualMemory::GetPageSize();
+        auto begin = reinterpret_cast<uintptr_t>(range.Data()) & ~(pageSize - 1);
+        auto length = reinterpret_cast<uintptr_t>(range.end()) - begin;
+
+#ifdef _WIN32
+#if _WIN32_WINNT >= 0x0602
+        if (MappedAccessHint::WillNeed == hint)
+        {
+            WIN32_MEMORY_RANGE_ENTRY entry{reinterpret_cast<void*>(begin), length};
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+        }
+#else
+        (void) hint;
+        (void) length;
+#endif
+#else
+        auto advice = MappedAccessHint::Sequential == hint ? MADV_SEQUENTIAL
+                    : MappedAccessHint::Random == hint     ? MADV_RANDOM
+                    : MappedAccessHint::WillNeed == hint   ? MADV_WILLNEED
+                                                           : MADV_NORMAL;
+        madvise(reinterpret_cast<void*>(begin), length, advice);
+#endif
+    }
+
+    void MappedBuffer::StartPrefetch(uint32_t offset, uint32_t size)
+    {
+        StopPrefetch();
+
+        auto range = Slice(offset, size);
+        if (range.Empty()) { return; }
+
+        m_StopPrefetch.store(false, std::memory_order_relaxed);
+        m_PrefetchThread = std::thread([this, range]() {
+            // Reading one byte per page is enough to fault it in.
+            auto pageSize = VirtualMemory::GetPageSize();
+            volatile uint8_t sink = 0;
+            // 64 bit, a 32 bit offset wraps past the end of a range close to 4 GiB and never leaves the loop.
+            for (uint64_t pageOffset = 0; pageOffset < range.GetSize(); pageOffset += pageSize)
+            {
+                if (m_StopPrefetch.load(std::memory_order_relaxed)) { return; }
+                sink = sink + range[static_cast<uint32_t>(pageOffset)];
+            }
+        });
+    }
+
+    void MappedBuffer::StopPrefetch()
+    {
+        if (!m_PrefetchThread.joinable()) { return; }
+
+        m_StopPrefetch.store(true, std::memory_order_relaxed);
+        m_PrefetchThread.join();
+    }
+}// namespace Engine
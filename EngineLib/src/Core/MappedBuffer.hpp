@@ -0,0 +1,111 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * MappedBuffer class definition
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <thread>
+
+#include <Core/BufferView.hpp>
+#include <Core/Error.hpp>
+
+namespace Engine
+{
+    enum class MappedBufferState
+    {
+        Closed,
+        Mapped
+    };
+
+    enum class MappedAccessHint
+    {
+        Normal,
+        Sequential,
+        Random,
+        WillNeed
+    };
+
+    /**
+     * Read only view of a whole file mapped into memory.
+     *
+     * Pages are faulted in from the page cache on first touch instead of being read and copied up front. Access hints
+     * go to madvise (PrefetchVirtualMemory for WillNeed on Windows). StartPrefetch() touches every page from a
+     * background thread so the faults are paid before the data is needed. Files are limited to 4 GiB like Buffer.
+     */
+    class MappedBuffer
+    {
+    public:
+        MappedBuffer() = default;
+        ~MappedBuffer();
+
+        MappedBuffer(const MappedBuffer&) = delete;
+        MappedBuffer& operator=(const MappedBuffer&) = delete;
+
+    public:
+        std::expected<MappedBufferState, ErrorStatus> Open(const std::filesystem::path& path,
+                                                           MappedAccessHint hint = MappedAccessHint::Normal);
+
+        MappedBufferState Close();
+
+        void Advise(MappedAccessHint hint, uint32_t offset = 0, uint32_t size = UINT32_MAX);
+
+        void StartPrefetch(uint32_t offset = 0, uint32_t size = UINT32_MAX);
+
+        void StopPrefetch();
+
+    public:
+        BufferView GetView() const { return {m_Data, m_Size}; }
+
+        BufferView ReadBytes(uint32_t size, uint32_t offset) const { return GetView().Slice(offset, size); }
+
+        BufferView Slice(uint32_t offset, uint32_t size = UINT32_MAX) const { return GetView().Slice(offset, size); }
+
+        template <typename T>
+        T Read(uint32_t offset = 0) const
+        {
+            return GetView().Read<T>(offset);
+        }
+
+        template <typename T>
+        std::span<const T> As() const
+        {
+            return GetView().As<T>();
+        }
+
+        const uint8_t* Data() const { return m_Data; }
+
+        uint32_t GetSize() const { return m_Size; }
+
+        bool IsMapped() const { return MappedBufferState::Mapped == m_State; }
+
+    public:
+        operator BufferView() const { return GetView(); }
+
+        explicit operator bool() const { return IsMapped(); }
+
+    private:
+        const uint8_t* m_Data{};
+        uint32_t m_Size{};
+        MappedBufferState m_State{MappedBufferState::Closed};
+
+#ifdef _WIN32
+        void* m_FileHandle{};
+        void* m_MappingHandle{};
+#endif
+
+        std::thread m_PrefetchThread;
+        std::atomic<bool> m_StopPrefetch{};
+    };
+}// namespace Engine
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * MemorySnapshot class implementation
+ */
+
+#include "MemorySnapshot.hpp"
+#include <Core/AllocationTracker.hpp>
+#include <Core/Log.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace Engine
+{
+    namespace
+    {
+        uint64_t GetEntryKey(CallStackId callStack, MemoryTag tag)
+        {
+            return callStack ^ (static_cast<uint64_t>(tag) * 0x9E3779B97F4A7C15ull);
+        }
+
+        void LogCallStack(CallStackId callStack)
+        {
+            if (CallStack::Invalid == callStack)
+            {
+                LOG_WARNING("        <call stack not captured>\n");
+                return;
+            }
+            for (auto& frame: CallStack::Symbolize(callStack)) { LOG_WARNING("        %s\n", frame.c_str()); }
+        }
+    }// namespace
+
+    MemorySnapshot MemorySnapshot::Take()
+    {
+        std::unordered_map<uint64_t, MemorySnapshotEntry> entries;
+        AllocationTracker::ForEachAllocation([&entries](const void*, const AllocationRecord& record) {
+            auto& entry = entries[GetEntryKey(record.CallStack, record.Tag)];
+            entry.CallStack = record.CallStack;
+            entry.Tag = record.Tag;
+            entry.Bytes += record.Size;
+            entry.Count++;
+        });
+
+        MemorySnapshot snapshot;
+        snapshot.m_Entries.reserve(entries.size());
+        for (auto& [key, entry]: entries)
+        {
+            snapshot.m_Entries.push_back(entry);
+            snapshot.m_TotalBytes += entry.Bytes;
+            snapshot.m_TotalCount += entry.Count;
+        }
+        std::sort(snapshot.m_Entries.begin(), snapshot.m_Entries.end(),
+                  [](const auto& left, const auto& right) { return left.Bytes > right.Bytes; });
+        return snapshot;
+    }
+
+    std::vector<MemorySnapshotDiffEntry> MemorySnapshot::Diff(const MemorySnapshot& from, const MemorySnapshot& to)
+    {
+        std::unordered_map<uint64_t, MemorySnapshotDiffEntry> entries;
+        for (auto& entry: to.m_Entries)
+        {
+            auto& diff = entries[GetEntryKey(entry.CallStack, entry.Tag)];
+            diff = {entry.CallStack, entry.Tag, int64_t(entry.Bytes), int64_t(entry.Count)};
+        }
+        for (auto& entry: from.m_Entries)
+        {
+            auto& diff = entries[GetEntryKey(entry.CallStack, entry.Tag)];
+            diff.CallStack = entry.CallStack;
+            diff.Tag = entry.Tag;
+            diff.Bytes -= int64_t(entry.Bytes);
+            diff.Count -= int64_t(entry.Count);
+        }
+
+        std::vector<MemorySnapshotDiffEntry> result;
+        for (auto& [key, diff]: entries)
+        {
+            if (0 != diff.Bytes || 0 != diff.Count) { result.push_back(diff); }
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const auto& left, const auto& right) { return left.Bytes > right.Bytes; });
+        return result;
+    }
+
+    void MemorySnapshot::LogDiff(const MemorySnapshot& from, const MemorySnapshot& to, size_t maxEntries)
+    {
+        auto diff = Diff(from, to);
+        LOG_WARNING("Memory diff: %lldB in %lld allocations across %zu call sites\n",
+                    (long long) to.m_TotalBytes - (long long) from.m_TotalBytes,
+                    (long long) to.m_TotalCount - (long long) from.m_TotalCount, diff.size());
+
+        for (size_t index = 0; index < std::min(maxEntries, diff.size()); index++)
+        {
+            auto& entry = diff[index];
+            LOG_WARNING("    %+lldB in %+lld allocations [%s]\n", (long long) entry.Bytes, (long long) entry.Count,
+                        MemoryTagToString(entry.Tag));
+            LogCallStack(entry.CallStack);
+        }
+    }
+
+    void MemorySnapshot::Log(size_t maxEntries) const
+    {
+        LOG_WARNING("Memory snapshot: %zuB in %zu allocations across %zu call sites\n", m_TotalBytes, m_TotalCount,
+                    m_Entries.size());
+
+        for (size_t index = 0; index < std::min(maxEntries, m_Entries.size()); index++)
+        {
+            auto& entry = m_Entries[index];
+            LOG_WARNING("    %zuB in %zu allocations [%s]\n", entry.Bytes, entry.Count, MemoryTagToString(entry.Tag));
+            LogCallStack(entry.CallStack);
+        }
+    }
+
+    const std::vector<MemorySnapshotEntry>& MemorySnapshot::GetEntries() const { return m_Entries; }
+
+    size_t MemorySnapshot::GetTotalBytes() const { return m_TotalBytes; }
+
+    size_t MemorySnapshot::GetTotalCount() const { return m_TotalCount; }
+}// namespace Engine
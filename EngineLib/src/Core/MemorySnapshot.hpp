@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * MemorySnapshot class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Core/CallStack.hpp>
+#include <Core/MemoryTag.hpp>
+
+namespace Engine
+{
+    struct MemorySnapshotEntry {
+        CallStackId CallStack{};
+        MemoryTag Tag{};
+        size_t Bytes{};
+        size_t Count{};
+    };
+
+    struct MemorySnapshotDiffEntry {
+        CallStackId CallStack{};
+        MemoryTag Tag{};
+        int64_t Bytes{};
+        int64_t Count{};
+    };
+
+    /**
+     * Live allocations grouped by call site and tag, largest first. Call sites are only known while call stack
+     * capture is enabled, everything else is grouped under CallStack::Invalid.
+     */
+    class MemorySnapshot
+    {
+    public:
+        static MemorySnapshot Take();
+
+        static std::vector<MemorySnapshotDiffEntry> Diff(const MemorySnapshot& from, const MemorySnapshot& to);
+
+        static void LogDiff(const MemorySnapshot& from, const MemorySnapshot& to, size_t maxEntries = 16);
+
+    public:
+        void Log(size_t maxEntries = 16) const;
+
+        const std::vector<MemorySnapshotEntry>& GetEntries() const;
+
+        size_t GetTotalBytes() const;
+
+        size_t GetTotalCount() const;
+
+    private:
+        std::vector<MemorySnapshotEntry> m_Entries;
+        size_t m_TotalBytes{};
+        size_t m_TotalCount{};
+    };
+}// namespace Engine
@@ -0,0 +1,93 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * MemoryTag definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine
+{
+    enum class MemoryTag : uint8_t
+    {
+        Core,
+        Renderer,
+        Layer,
+        Asset,
+        Transient,
+        Count
+    };
+
+    inline constexpr size_t MemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+    inline constexpr const char* MemoryTagToString(MemoryTag tag)
+    {
+        switch (tag)
+        {
+            case MemoryTag::Core:
+                return "Core";
+            case MemoryTag::Renderer:
+                return "Renderer";
+            case MemoryTag::Layer:
+                return "Layer";
+            case MemoryTag::Asset:
+                return "Asset";
+            case MemoryTag::Transient:
+                return "Transient";
+            default:
+                return "Unknown";
+        }
+    }
+
+    enum class MemoryBudgetLevel
+    {
+        Soft,
+        Hard
+    };
+
+    /** A budget of 0 is disabled. */
+    struct MemoryBudget {
+        size_t Soft{};
+        size_t Hard{};
+    };
+
+    struct MemoryTagStats {
+        size_t LiveBytes{};
+        size_t PeakBytes{};
+        size_t LiveAllocations{};
+        size_t AllocationCount{};
+        MemoryBudget Budget{};
+    };
+
+    using MemoryBudgetCallback = void (*)(MemoryTag tag, MemoryBudgetLevel level, size_t liveBytes, size_t budget);
+
+    /**
+     * Sets the tag used by allocations on this thread that do not pass one explicitly, restored on scope exit.
+     */
+    class MemoryTagScope
+    {
+    public:
+        MemoryTagScope(MemoryTag tag) : m_Previous(s_Current) { s_Current = tag; }
+
+        ~MemoryTagScope() { s_Current = m_Previous; }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    public:
+        static MemoryTag GetCurrent() { return s_Current; }
+
+    private:
+        MemoryTag m_Previous;
+
+        inline static thread_local MemoryTag s_Current = MemoryTag::Core;
+    };
+}// namespace Engine
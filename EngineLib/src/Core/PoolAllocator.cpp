@@ -0,0 +1,316 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * PoolAllocator class implementation
+ */
+
+#include "PoolAllocator.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr size_t SizeClassCount = PoolStats::SizeClassCount;
+        constexpr std::array<size_t, SizeClassCount> s_BlockSizes = {16,  32,  48,  64,  80,  96,  112, 128,
+                                                                     160, 192, 224, 256, 320, 384, 448, 512};
+        constexpr uint32_t BatchSize = 32;
+        constexpr uint32_t MaxCachedBlocks = BatchSize * 2;
+
+        static_assert(s_BlockSizes.back() == PoolAllocator::MaxBlockSize);
+
+        constexpr auto MakeSizeClassTable()
+        {
+            std::array<uint8_t, PoolAllocator::MaxBlockSize / PoolAllocator::BlockAlignment + 1> table{};
+            size_t sizeClass = 0;
+            for (size_t index = 0; index < table.size(); index++)
+            {
+                while (s_BlockSizes[sizeClass] < index * PoolAllocator::BlockAlignment) { sizeClass++; }
+                table[index] = static_cast<uint8_t>(sizeClass);
+            }
+            return table;
+        }
+
+        constexpr auto s_SizeClassTable = MakeSizeClassTable();
+
+        size_t GetSizeClass(size_t size)
+        {
+            return s_SizeClassTable[(size + PoolAllocator::BlockAlignment - 1) / PoolAllocator::BlockAlignment];
+        }
+
+        struct FreeBlock {
+            FreeBlock* Next;
+        };
+
+        struct FreeList {
+            FreeBlock* Head{};
+            uint32_t Count{};
+
+            void Push(FreeBlock* block)
+            {
+                block->Next = Head;
+                Head = block;
+                Count++;
+            }
+
+            FreeBlock* Pop()
+            {
+                auto block = Head;
+                Head = block->Next;
+                Count--;
+                return block;
+            }
+        };
+
+        struct alignas(64) SizeClass {
+            std::mutex Lock;
+            FreeList Blocks;
+            uint8_t* Cursor{};
+            size_t Remaining{};
+            std::vector<void*> Slabs;
+            size_t RefillCount{};
+        };
+
+        SizeClass* GetSizeClasses()
+        {
+            // Never destroyed, pooled objects may still be released from static destructors.
+            static SizeClass* sizeClasses = new SizeClass[SizeClassCount];
+            return sizeClasses;
+        }
+
+        void RefillLocked(SizeClass& sizeClass, size_t blockSize, FreeList& destination, uint32_t count)
+        {
+            sizeClass.RefillCount++;
+            while (count > 0 && sizeClass.Blocks.Count > 0)
+            {
+                destination.Push(sizeClass.Blocks.Pop());
+                count--;
+            }
+
+            while (count > 0)
+            {
+                if (sizeClass.Remaining < blockSize)
+                {
+                    auto slab = ::operator new(PoolAllocator::SlabSize, std::align_val_t(PoolAllocator::BlockAlignment));
+                    sizeClass.Slabs.push_back(slab);
+                    sizeClass.Cursor = static_cast<uint8_t*>(slab);
+                    sizeClass.Remaining = PoolAllocator::SlabSize;
+                }
+
+                destination.Push(reinterpret_cast<FreeBlock*>(sizeClass.Cursor));
+                sizeClass.Cursor += blockSize;
+                sizeClass.Remaining -= blockSize;
+                count--;
+            }
+        }
+
+        struct ClassCounters {
+            std::atomic<size_t> AllocationCount{};
+            std::atomic<size_t> FreeCount{};
+            std::atomic<size_t> RequestedAllocated{};
+            std::atomic<size_t> RequestedFreed{};
+        };
+
+        struct ThreadCache {
+            std::array<FreeList, SizeClassCount> Bins{};
+            std::array<ClassCounters, SizeClassCount> Counters{};
+        };
+
+        struct RetiredCounters {
+            size_t AllocationCount{};
+            size_t FreeCount{};
+            size_t RequestedAllocated{};
+            size_t RequestedFreed{};
+        };
+
+        std::mutex s_ThreadCachesLock;
+        std::vector<ThreadCache*> s_ThreadCaches;
+        std::array<RetiredCounters, SizeClassCount> s_RetiredCounters{};
+
+        thread_local ThreadCache* t_ThreadCache{};
+        thread_local bool t_ThreadCacheReleased{};
+
+        void ReleaseThreadCache(ThreadCache* cache)
+        {
+            for (size_t index = 0; index < SizeClassCount; index++)
+            {
+                auto& bin = cache->Bins[index];
+                auto& sizeClass = GetSizeClasses()[index];
+                if (bin.Count > 0)
+                {
+                    std::lock_guard<std::mutex> lock(sizeClass.Lock);
+                    while (bin.Count > 0) { sizeClass.Blocks.Push(bin.Pop()); }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(s_ThreadCachesLock);
+            for (size_t index = 0; index < SizeClassCount; index++)
+            {
+                auto& counters = cache->Counters[index];
+                auto& retired = s_RetiredCounters[index];
+                retired.AllocationCount += counters.AllocationCount.load(std::memory_order_relaxed);
+                retired.FreeCount += counters.FreeCount.load(std::memory_order_relaxed);
+                retired.RequestedAllocated += counters.RequestedAllocated.load(std::memory_order_relaxed);
+                retired.RequestedFreed += counters.RequestedFreed.load(std::memory_order_relaxed);
+            }
+            std::erase(s_ThreadCaches, cache);
+            delete cache;
+        }
+
+        struct ThreadCacheRelease {
+            ~ThreadCacheRelease()
+            {
+                if (t_ThreadCache) { ReleaseThreadCache(t_ThreadCache); }
+                t_ThreadCache = nullptr;
+                t_ThreadCacheReleased = true;
+            }
+        };
+
+        // Returns nullptr once the calling thread is shutting down, callers then go straight to the shared lists.
+        ThreadCache* GetThreadCache()
+        {
+            if (nullptr == t_ThreadCache && !t_ThreadCacheReleased)
+            {
+                auto cache = new ThreadCache();
+                {
+                    std::lock_guard<std::mutex> lock(s_ThreadCachesLock);
+                    s_ThreadCaches.push_back(cache);
+                }
+                t_ThreadCache = cache;
+
+                thread_local ThreadCacheRelease release;
+                (void) release;
+            }
+            return t_ThreadCache;
+        }
+
+        // Only the owning thread writes its counters, so a relaxed load/store pair is enough.
+        void Increment(std::atomic<size_t>& counter, size_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    }// namespace
+
+    void* PoolAllocator::Allocate(size_t size)
+    {
+        if (!CanAllocate(size)) { return nullptr; }
+
+        auto index = GetSizeClass(size);
+        auto& sizeClass = GetSizeClasses()[index];
+        auto cache = GetThreadCache();
+        if (nullptr == cache)
+        {
+            FreeList single;
+            std::lock_guard<std::mutex> lock(sizeClass.Lock);
+            RefillLocked(sizeClass, s_BlockSizes[index], single, 1);
+            return single.Pop();
+        }
+
+        auto& bin = cache->Bins[index];
+        if (0 == bin.Count)
+        {
+            std::lock_guard<std::mutex> lock(sizeClass.Lock);
+            RefillLocked(sizeClass, s_BlockSizes[index], bin, BatchSize);
+        }
+
+        auto& counters = cache->Counters[index];
+        Increment(counters.AllocationCount, 1);
+        Increment(counters.RequestedAllocated, size);
+        return bin.Pop();
+    }
+
+    void PoolAllocator::Deallocate(void* block, size_t size)
+    {
+        if (nullptr == block || !CanAllocate(size)) { return; }
+
+        auto index = GetSizeClass(size);
+        auto& sizeClass = GetSizeClasses()[index];
+        auto cache = GetThreadCache();
+        if (nullptr == cache)
+        {
+            std::lock_guard<std::mutex> lock(sizeClass.Lock);
+            sizeClass.Blocks.Push(static_cast<FreeBlock*>(block));
+            return;
+        }
+
+        auto& bin = cache->Bins[index];
+        bin.Push(static_cast<FreeBlock*>(block));
+        if (bin.Count > MaxCachedBlocks)
+        {
+            std::lock_guard<std::mutex> lock(sizeClass.Lock);
+            while (bin.Count > BatchSize) { sizeClass.Blocks.Push(bin.Pop()); }
+        }
+
+        auto& counters = cache->Counters[index];
+        Increment(counters.FreeCount, 1);
+        Increment(counters.RequestedFreed, size);
+    }
+
+    PoolStats PoolAllocator::GetStats()
+    {
+        std::array<RetiredCounters, SizeClassCount> totals{};
+        {
+            std::lock_guard<std::mutex> lock(s_ThreadCachesLock);
+            totals = s_RetiredCounters;
+            for (auto cache: s_ThreadCaches)
+            {
+                for (size_t index = 0; index < SizeClassCount; index++)
+                {
+                    auto& counters = cache->Counters[index];
+                    totals[index].AllocationCount += counters.AllocationCount.load(std::memory_order_relaxed);
+                    totals[index].FreeCount += counters.FreeCount.load(std::memory_order_relaxed);
+                    totals[index].RequestedAllocated += counters.RequestedAllocated.load(std::memory_order_relaxed);
+                    totals[index].RequestedFreed += counters.RequestedFreed.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        PoolStats stats{};
+        for (size_t index = 0; index < SizeClassCount; index++)
+        {
+            auto& sizeClass = GetSizeClasses()[index];
+            auto& classStats = stats.SizeClasses[index];
+            {
+                std::lock_guard<std::mutex> lock(sizeClass.Lock);
+                classStats.SlabCount = sizeClass.Slabs.size();
+                classStats.RefillCount = sizeClass.RefillCount;
+            }
+
+            auto& total = totals[index];
+            classStats.BlockSize = s_BlockSizes[index];
+            classStats.ReservedBytes = classStats.SlabCount * SlabSize;
+            classStats.AllocationCount = total.AllocationCount;
+            classStats.FreeCount = total.FreeCount;
+            classStats.LiveBlocks = total.AllocationCount > total.FreeCount ? total.AllocationCount - total.FreeCount : 0;
+            classStats.RequestedBytes = total.RequestedAllocated > total.RequestedFreed
+                                                ? total.RequestedAllocated - total.RequestedFreed
+                                                : 0;
+
+            stats.ReservedBytes += classStats.ReservedBytes;
+            stats.LiveBytes += classStats.LiveBlocks * classStats.BlockSize;
+            stats.RequestedBytes += classStats.RequestedBytes;
+            stats.AllocationCount += classStats.AllocationCount;
+            stats.FreeCount += classStats.FreeCount;
+            stats.RefillCount += classStats.RefillCount;
+        }
+
+        if (stats.LiveBytes > 0)
+        {
+            stats.InternalFragmentation = 1.0 - double(stats.RequestedBytes) / double(stats.LiveBytes);
+        }
+        if (stats.ReservedBytes > 0)
+        {
+            stats.ExternalFragmentation = 1.0 - double(stats.LiveBytes) / double(stats.ReservedBytes);
+        }
+        return stats;
+    }
+}// namespace Engine
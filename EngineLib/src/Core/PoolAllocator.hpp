@@ -0,0 +1,75 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * PoolAllocator class definition
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine
+{
+    struct PoolSizeClassStats {
+        size_t BlockSize{};
+        size_t SlabCount{};
+        size_t ReservedBytes{};
+        size_t LiveBlocks{};
+        size_t RequestedBytes{};
+        size_t AllocationCount{};
+        size_t FreeCount{};
+        size_t RefillCount{};
+    };
+
+    struct PoolStats {
+        static constexpr size_t SizeClassCount = 16;
+
+        std::array<PoolSizeClassStats, SizeClassCount> SizeClasses{};
+        size_t ReservedBytes{};
+        size_t LiveBytes{};
+        size_t RequestedBytes{};
+        size_t AllocationCount{};
+        size_t FreeCount{};
+        size_t RefillCount{};
+
+        /** Share of the handed out blocks lost to rounding up to the size class. */
+        double InternalFragmentation{};
+
+        /** Share of the reserved slab memory that is not handed out. */
+        double ExternalFragmentation{};
+    };
+
+    /**
+     * Slab allocator with fixed size classes up to MaxBlockSize bytes.
+     *
+     * Each thread keeps a free list per size class and only takes the class lock to move a batch of blocks between
+     * its list and the shared one, so the common allocate/free is a pointer pop/push. Blocks freed on another thread
+     * go to that thread's list. Slabs are never returned to the system.
+     */
+    class PoolAllocator
+    {
+    public:
+        static constexpr size_t MaxBlockSize = 512;
+        static constexpr size_t BlockAlignment = 16;
+        static constexpr size_t SlabSize = 64 * 1024;
+
+    public:
+        static void* Allocate(size_t size);
+
+        static void Deallocate(void* block, size_t size);
+
+        static PoolStats GetStats();
+
+        static constexpr bool CanAllocate(size_t size, size_t alignment = BlockAlignment)
+        {
+            return size > 0 && size <= MaxBlockSize && alignment <= BlockAlignment;
+        }
+    };
+}// namespace Engine
@@ -0,0 +1,265 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Profiler class implementation
+ */
+
+#include "Profiler.hpp"
+#include <Core/Clock.hpp>
+#include <Core/Log.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr uint32_t ChunkCapacity = 4096;
+
+        /** Only the owning thread appends, Count publishes the events to WriteChromeTrace(). */
+        struct EventChunk {
+            std::atomic<uint32_t> Count{};
+            std::atomic<EventChunk*> Next{};
+            ProfileEvent Events[ChunkCapacity];
+        };
+
+        struct ThreadBuffer {
+            EventChunk* First{};
+            EventChunk* Current{};
+            uint32_t EventCount{};
+            uint32_t Index{};
+            std::atomic<uint64_t> Dropped{};
+            /** Guarded by s_BuffersMutex. */
+            std::string Name;
+        };
+
+        // Buffers are allocated with malloc so the profiler does not show up in allocation tracking.
+        EventChunk* AllocateChunk() { return new (std::malloc(sizeof(EventChunk))) EventChunk(); }
+
+        void FreeChunks(EventChunk* chunk)
+        {
+            while (chunk)
+            {
+                auto* next = chunk->Next.load(std::memory_order_relaxed);
+                chunk->~EventChunk();
+                std::free(chunk);
+                chunk = next;
+            }
+        }
+
+        ProfilerSpec s_Spec{};
+        int64_t s_StartTime{};
+        std::atomic<uint64_t> s_Generation{1};
+
+        std::mutex s_BuffersMutex;
+        std::vector<ThreadBuffer*> s_Buffers;
+
+        thread_local ThreadBuffer* t_Buffer{};
+        thread_local uint64_t t_Generation{};
+
+        ThreadBuffer* GetThreadBuffer()
+        {
+            auto generation = s_Generation.load(std::memory_order_acquire);
+            if (t_Buffer && t_Generation == generation) { return t_Buffer; }
+
+            auto* buffer = new (std::malloc(sizeof(ThreadBuffer))) ThreadBuffer();
+            buffer->First = buffer->Current = AllocateChunk();
+            {
+                std::lock_guard lock(s_BuffersMutex);
+                buffer->Index = static_cast<uint32_t>(s_Buffers.size());
+                buffer->Name = "Thread " + std::to_string(buffer->Index);
+                s_Buffers.push_back(buffer);
+            }
+            t_Buffer = buffer;
+            t_Generation = generation;
+            return buffer;
+        }
+
+        void Append(ProfileEvent event)
+        {
+            auto* buffer = GetThreadBuffer();
+            if (buffer->EventCount >= s_Spec.MaxEventsPerThread)
+            {
+                buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            auto* chunk = buffer->Current;
+            auto count = chunk->Count.load(std::memory_order_relaxed);
+            if (ChunkCapacity == count)
+            {
+                auto* next = AllocateChunk();
+                chunk->Next.store(next, std::memory_order_release);
+                buffer->Current = chunk = next;
+                count = 0;
+            }
+
+            chunk->Events[count] = event;
+            chunk->Count.store(count + 1, std::memory_order_release);
+            buffer->EventCount++;
+        }
+
+        void AppendJsonString(std::string& output, std::string_view text)
+        {
+            output.push_back('"');
+            for (char c: text)
+            {
+                if ('"' == c || '\\' == c)
+                {
+                    output.push_back('\\');
+                    output.push_back(c);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    output.append(escaped);
+                }
+                else { output.push_back(c); }
+            }
+            output.push_back('"');
+        }
+
+        /** Trace timestamps are microseconds since Init(). */
+        double ToMicroseconds(int64_t ticks) { return Clock::ToMicros(static_cast<uint64_t>(ticks)); }
+    }// namespace
+
+    std::atomic<bool> Profiler::s_Capturing;
+
+    void Profiler::Init(const ProfilerSpec& spec)
+    {
+        s_Spec = spec;
+        s_StartTime = Now();
+        SetCapturing(spec.Capture);
+    }
+
+    void Profiler::Shutdown()
+    {
+        SetCapturing(false);
+
+        bool recorded;
+        {
+            std::lock_guard lock(s_BuffersMutex);
+            recorded = !s_Buffers.empty();
+        }
+        if (!recorded) { return; }
+        if (!s_Spec.TracePath.empty()) { WriteChromeTrace(s_Spec.TracePath); }
+
+        std::vector<ThreadBuffer*> buffers;
+        {
+            std::lock_guard lock(s_BuffersMutex);
+            buffers.swap(s_Buffers);
+        }
+        s_Generation.fetch_add(1, std::memory_order_acq_rel);
+        for (auto* buffer: buffers)
+        {
+            FreeChunks(buffer->First);
+            buffer->~ThreadBuffer();
+            std::free(buffer);
+        }
+    }
+
+    void Profiler::SetCapturing(bool capturing) { s_Capturing.store(capturing, std::memory_order_relaxed); }
+
+    void Profiler::SetThreadName(std::string_view name)
+    {
+        auto* buffer = GetThreadBuffer();
+        std::lock_guard lock(s_BuffersMutex);
+        buffer->Name = name;
+    }
+
+    void Profiler::MarkFrame(uint64_t frameNumber)
+    {
+        if (!IsCapturing()) { return; }
+        Append({"Frame", 5, ProfileEventType::Frame, Now(), static_cast<int64_t>(frameNumber)});
+    }
+
+    void Profiler::Record(std::string_view name, int64_t start, int64_t end)
+    {
+        Append({name.data(), static_cast<uint32_t>(name.size()), ProfileEventType::Zone, start, end});
+    }
+
+    int64_t Profiler::Now() { return static_cast<int64_t>(Clock::Now()); }
+
+    std::expected<size_t, ErrorStatus> Profiler::WriteChromeTrace(const std::filesystem::path& path)
+    {
+        FILE* file = fopen(path.string().c_str(), "wb");
+        if (!file)
+        {
+            LOG_ERROR("Can Not Open %s!\n", path.string().c_str());
+            return std::unexpected(ErrorStatus::CanNotOpenFile);
+        }
+
+        std::lock_guard lock(s_BuffersMutex);
+
+        std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        size_t eventCount = 0;
+        char number[96];
+        for (auto* buffer: s_Buffers)
+        {
+            json.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+            json.append(std::to_string(buffer->Index));
+            json.append(",\"args\":{\"name\":");
+            AppendJsonString(json, buffer->Name);
+            json.append("}}");
+
+            for (auto* chunk = buffer->First; chunk; chunk = chunk->Next.load(std::memory_order_acquire))
+            {
+                auto count = chunk->Count.load(std::memory_order_acquire);
+                for (uint32_t index = 0; index < count; index++)
+                {
+                    const auto& event = chunk->Events[index];
+                    json.append(",\n{\"name\":");
+                    if (ProfileEventType::Frame == event.Type)
+                    {
+                        snprintf(number, sizeof(number), "\"Frame %lld\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f",
+                                 static_cast<long long>(event.End), ToMicroseconds(event.Start - s_StartTime));
+                    }
+                    else
+                    {
+                        AppendJsonString(json, {event.Name, event.NameLength});
+                        snprintf(number, sizeof(number), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                                 ToMicroseconds(event.Start - s_StartTime), ToMicroseconds(event.End - event.Start));
+                    }
+                    json.append(number);
+                    snprintf(number, sizeof(number), ",\"pid\":1,\"tid\":%u}", buffer->Index);
+                    json.append(number);
+                    eventCount++;
+                }
+
+                // Written in pieces so a long capture does not build the whole file in memory.
+                if (json.size() > (1 << 20))
+                {
+                    fwrite(json.data(), 1, json.size(), file);
+                    json.clear();
+                }
+            }
+            json.append(",\n");
+        }
+        if (json.ends_with(",\n")) { json.resize(json.size() - 2); }
+        json.append("\n]}\n");
+        fwrite(json.data(), 1, json.size(), file);
+        fclose(file);
+
+        LOG_INFO("Profiler trace with %zu events written to %s\n", eventCount, path.string().c_str());
+        return eventCount;
+    }
+
+    uint64_t Profiler::GetDroppedCount()
+    {
+        std::lock_guard lock(s_BuffersMutex);
+        uint64_t dropped = 0;
+        for (auto* buffer: s_Buffers) { dropped += buffer->Dropped.load(std::memory_order_relaxed); }
+        return dropped;
+    }
+}// namespace Engine
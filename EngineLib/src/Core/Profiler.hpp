@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Profiler class definition
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <string_view>
+
+#include <Core/Error.hpp>
+
+namespace Engine
+{
+    struct ProfilerSpec {
+        /** Capture from Init(), otherwise capturing starts with SetCapturing(true). */
+        bool Capture = true;
+        /** Events past this are counted and dropped. */
+        uint32_t MaxEventsPerThread = 1 << 20;
+        /** Chrome trace JSON written on Shutdown() when set, open it in Perfetto or chrome://tracing. */
+        std::filesystem::path TracePath;
+    };
+
+    enum class ProfileEventType : uint8_t
+    {
+        Zone,
+        Frame
+    };
+
+    struct ProfileEvent {
+        const char* Name;
+        uint32_t NameLength;
+        ProfileEventType Type;
+        int64_t Start;
+        /** End of a zone, the frame number of a frame marker. */
+        int64_t End;
+    };
+
+    /**
+     * Instrumentation profiler, zones are recorded with PROFILE_SCOPE and PROFILE_FUNCTION.
+     *
+     * Every thread appends finished zones to its own chunked event buffer, so recording never takes a lock. Nesting
+     * is not stored, it follows from the start and end times when the trace is viewed. Zone names are kept by
+     * pointer and have to outlive the profiler: string literals, function names or interned StringId text. Without
+     * ENGINE_ENABLE_PROFILER the macros expand to nothing.
+     */
+    class Profiler
+    {
+    public:
+        static void Init(const ProfilerSpec& spec = {});
+
+        /** Writes the trace when ProfilerSpec::TracePath is set, threads must have stopped recording. */
+        static void Shutdown();
+
+        static void SetCapturing(bool capturing);
+
+        static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+        /** Name of the calling thread in the trace, the text is copied. */
+        static void SetThreadName(std::string_view name);
+
+        static void MarkFrame(uint64_t frameNumber);
+
+        static void Record(std::string_view name, int64_t start, int64_t end);
+
+        static int64_t Now();
+
+        /** Safe while other threads record, returns the number of events written. */
+        static std::expected<size_t, ErrorStatus> WriteChromeTrace(const std::filesystem::path& path);
+
+        static uint64_t GetDroppedCount();
+
+    private:
+        static std::atomic<bool> s_Capturing;
+    };
+
+    /** "ReturnType Namespace::Class::Function(Args)" becomes "Namespace::Class::Function". */
+    consteval std::string_view GetProfileFunctionName(std::string_view signature)
+    {
+        size_t depth = 0;
+        size_t end = signature.size();
+        for (size_t index = 0; index < signature.size(); index++)
+        {
+            if ('<' == signature[index]) { depth++; }
+            else if ('>' == signature[index] && depth) { depth--; }
+            else if ('(' == signature[index] && 0 == depth)
+            {
+                end = index;
+                break;
+            }
+        }
+
+        size_t begin = 0;
+        for (size_t index = end; index > 0; index--)
+        {
+            if ('>' == signature[index - 1]) { depth++; }
+            else if ('<' == signature[index - 1] && depth) { depth--; }
+            else if (' ' == signature[index - 1] && 0 == depth)
+            {
+                begin = index;
+                break;
+            }
+        }
+        return signature.substr(begin, end - begin);
+    }
+
+    class ProfileScope
+    {
+    public:
+        ProfileScope(std::string_view name) : m_Name(name), m_Start(Profiler::IsCapturing() ? Profiler::Now() : -1)
+        {
+        }
+
+        ~ProfileScope()
+        {
+            if (m_Start >= 0) { Profiler::Record(m_Name, m_Start, Profiler::Now()); }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        std::string_view m_Name;
+        int64_t m_Start;
+    };
+}// namespace Engine
+
+#ifdef ENGINE_ENABLE_PROFILER
+#ifdef _MSC_VER
+#define ENGINE_PROFILE_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+#define ENGINE_PROFILE_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+#define ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) Engine::ProfileScope ENGINE_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(Engine::GetProfileFunctionName(ENGINE_PROFILE_FUNCTION_SIGNATURE))
+#define PROFILE_FRAME(frameNumber) Engine::Profiler::MarkFrame(frameNumber)
+#define PROFILE_THREAD(name) Engine::Profiler::SetThreadName(name)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#define PROFILE_FRAME(frameNumber)
+#define PROFILE_THREAD(name)
+#endif
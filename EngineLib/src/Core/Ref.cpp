@@ -1,30 +1,120 @@
-
-#include <unordered_map>
-#include <mutex>
 #include "Ref.hpp"
 
+#ifdef ENGINE_ENABLE_REF_COUNT_STATS
+namespace
+{
+    std::atomic<size_t> s_TotalRefCount{};
+}
+#endif
+
+bool RefControlBlock::TryIncStrongCount()
+{
+    auto count = StrongCount.load(std::memory_order_relaxed);
+    while (0 != count)
+    {
+        if (StrongCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+#ifdef ENGINE_ENABLE_REF_COUNT_STATS
+            s_TotalRefCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+            return true;
+        }
+    }
+    return false;
+}
+
+void RefControlBlock::IncWeakCount() { WeakCount.fetch_add(1, std::memory_order_relaxed); }
+
+void RefControlBlock::DecWeakCount()
+{
+    if (1 == WeakCount.fetch_sub(1, std::memory_order_acq_rel)) { Engine::Allocator::Deallocate(this); }
+}
+
+RefCounted::~RefCounted()
+{
+    // Drops the object's own weak count, the block stays for weak references that are still around.
+    auto word = m_RefCount.load(std::memory_order_acquire);
+    if (word & ControlBlockTag) { ToControlBlock(word)->DecWeakCount(); }
+}
+
 void RefCounted::IncRefCount() const
 {
-    m_RefCount++;
-    RefCounted::IncTotalRefCount();
+#ifdef ENGINE_ENABLE_REF_COUNT_STATS
+    s_TotalRefCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+    // The word can switch to a control block at any time, so the inline count is only ever changed with a CAS.
+    auto word = m_RefCount.load(std::memory_order_relaxed);
+    while (!(word & ControlBlockTag))
+    {
+        if (m_RefCount.compare_exchange_weak(word, word + CountIncrement, std::memory_order_relaxed)) { return; }
+    }
+    ToControlBlock(word)->StrongCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool RefCounted::DecRefCount() const
+{
+#ifdef ENGINE_ENABLE_REF_COUNT_STATS
+    s_TotalRefCount.fetch_sub(1, std::memory_order_relaxed);
+#endif
+    auto word = m_RefCount.load(std::memory_order_relaxed);
+    while (!(word & ControlBlockTag))
+    {
+        if (m_RefCount.compare_exchange_weak(word, word - CountIncrement, std::memory_order_release,
+                                             std::memory_order_relaxed))
+        {
+            if (CountIncrement != word) { return false; }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+    }
+
+    if (1 != ToControlBlock(word)->StrongCount.fetch_sub(1, std::memory_order_release)) { return false; }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
 }
 
-void RefCounted::DecRefCount() const
+uint32_t RefCounted::GetRefCount() const
 {
-    m_RefCount--;
-    RefCounted::DecTotalRefCount();
+    auto word = m_RefCount.load(std::memory_order_relaxed);
+    if (word & ControlBlockTag) { return ToControlBlock(word)->StrongCount.load(std::memory_order_relaxed); }
+    return static_cast<uint32_t>(word / CountIncrement);
 }
 
-uint32_t RefCounted::GetRefCount() const { return m_RefCount.load(); }
+RefControlBlock* RefCounted::AcquireControlBlock() const
+{
+    auto word = m_RefCount.load(std::memory_order_acquire);
+    while (!(word & ControlBlockTag))
+    {
+        // One weak count for the object and one for the caller.
+        auto controlBlock = Engine::Allocator::Allocate<RefControlBlock>();
+        controlBlock->StrongCount.store(static_cast<uint32_t>(word / CountIncrement), std::memory_order_relaxed);
+        controlBlock->WeakCount.store(2, std::memory_order_relaxed);
+
+        auto tagged = reinterpret_cast<uintptr_t>(controlBlock) | ControlBlockTag;
+        if (m_RefCount.compare_exchange_strong(word, tagged, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return controlBlock;
+        }
+        Engine::Allocator::Deallocate(controlBlock);
+    }
 
-void RefCounted::IncTotalRefCount()
+    auto controlBlock = ToControlBlock(word);
+    controlBlock->IncWeakCount();
+    return controlBlock;
+}
+
+size_t RefCounted::GetTotalRefCount()
 {
-    RefCounted::s_TotalRefCount++;
-    LOG_MEMORY_ALLOC("Total RefCount: %i\n", RefCounted::s_TotalRefCount);
+#ifdef ENGINE_ENABLE_REF_COUNT_STATS
+    return s_TotalRefCount.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
 }
 
-void RefCounted::DecTotalRefCount()
+RefControlBlock* RefCounted::ToControlBlock(uintptr_t word)
 {
-    RefCounted::s_TotalRefCount--;
-    LOG_MEMORY_ALLOC("Total RefCount: %i\n", RefCounted::s_TotalRefCount);
-}
\ No newline at end of file
+    return reinterpret_cast<RefControlBlock*>(word & ~ControlBlockTag);
+}
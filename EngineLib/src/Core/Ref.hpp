@@ -1,59 +1,163 @@
 #pragma once
 
-#include <mutex>
 #include <atomic>
 
 #include <Core/Core.hpp>
 #include <Core/Allocator.hpp>
 
+/**
+ * Strong and weak counts of an object that has weak references, outlives the object until the last weak reference
+ * is gone. The object itself holds one weak count while it is alive.
+ */
+struct RefControlBlock {
+    std::atomic<uint32_t> StrongCount{};
+    std::atomic<uint32_t> WeakCount{};
+
+    /** Takes a strong reference unless the object is already being destroyed. */
+    bool TryIncStrongCount();
+
+    void IncWeakCount();
+
+    void DecWeakCount();
+};
+
+/**
+ * Intrusive reference count.
+ *
+ * Increments are relaxed, a new reference can only be made from an existing one. Decrements release and the last one
+ * acquires, so every write made through other references is visible to the destructor.
+ *
+ * The count is stored inline until the first weak reference is taken, then it moves into a RefControlBlock and the
+ * word holds the tagged block pointer instead, so objects without weak references never allocate one.
+ */
 class RefCounted
 {
+public:
+    RefCounted() = default;
+    ~RefCounted();
+
+    RefCounted(const RefCounted&) = delete;
+    RefCounted& operator=(const RefCounted&) = delete;
+
 public:
     void IncRefCount() const;
 
-    void DecRefCount() const;
+    /** Returns true when the last reference was dropped and the object has to be destroyed. */
+    bool DecRefCount() const;
 
     uint32_t GetRefCount() const;
 
+    /** Returns the control block with one weak count taken for the caller. */
+    RefControlBlock* AcquireControlBlock() const;
+
+    /** Sum of all reference counts, only counted with ENGINE_ENABLE_REF_COUNT_STATS. */
+    static size_t GetTotalRefCount();
+
+private:
+    static constexpr uintptr_t ControlBlockTag = 1;
+    static constexpr uintptr_t CountIncrement = 2;
+
+    static RefControlBlock* ToControlBlock(uintptr_t word);
+
+private:
+    mutable std::atomic<uintptr_t> m_RefCount = 0;
+};
+
+/**
+ * Non atomic reference count for objects that never leave the thread that owns them, e.g. the main thread only
+ * window. Saves the atomic read-modify-write on every copy, has no weak reference support.
+ */
+class LocalRefCounted
+{
+public:
+    LocalRefCounted() = default;
+    ~LocalRefCounted() = default;
+
+    LocalRefCounted(const LocalRefCounted&) = delete;
+    LocalRefCounted& operator=(const LocalRefCounted&) = delete;
+
+public:
+    void IncRefCount() const { m_RefCount++; }
+
+    /** Returns true when the last reference was dropped and the object has to be destroyed. */
+    bool DecRefCount() const { return 0 == --m_RefCount; }
+
+    uint32_t GetRefCount() const { return m_RefCount; }
+
 private:
-    static void IncTotalRefCount();
+    mutable uint32_t m_RefCount = 0;
+};
+
+/** Counts through RefCounted, objects can be shared between threads and have weak references. */
+struct AtomicRefPolicy {
+    using CountedType = RefCounted;
+
+    static void IncRef(const RefCounted* instance) { instance->IncRefCount(); }
+
+    static bool DecRef(const RefCounted* instance) { return instance->DecRefCount(); }
+};
+
+/** Counts through LocalRefCounted, single threaded. */
+struct LocalRefPolicy {
+    using CountedType = LocalRefCounted;
 
-    static void DecTotalRefCount();
+    static void IncRef(const LocalRefCounted* instance) { instance->IncRefCount(); }
 
-    inline static size_t s_TotalRefCount = 0;
-    mutable std::atomic<uint32_t> m_RefCount = 0;
+    static bool DecRef(const LocalRefCounted* instance) { return instance->DecRefCount(); }
 };
 
-inline static std::mutex m{};
+/**
+ * Picks the policy matching the counter base of T. Resolved inside Ref's member functions, so a Ref<T> member can
+ * still be declared while T is incomplete.
+ */
+struct DefaultRefPolicy {
+};
+
+template <typename T, typename Policy>
+struct RefPolicySelector {
+    using Type = Policy;
+};
 
 template <typename T>
+struct RefPolicySelector<T, DefaultRefPolicy> {
+    using Type = std::conditional_t<std::is_base_of_v<LocalRefCounted, T>, LocalRefPolicy, AtomicRefPolicy>;
+};
+
+template <typename T, typename Policy>
+using RefPolicyType = typename RefPolicySelector<T, Policy>::Type;
+
+template <typename T, typename Policy = DefaultRefPolicy>
 class Ref
 {
 public:
     Ref() = default;
 
-    Ref(T* instance = nullptr);
+    Ref(T* instance);
 
     template <typename T2>
-    Ref(const Ref<T2>& other);
+    Ref(const Ref<T2, Policy>& other);
 
     template <typename T2>
-    Ref(Ref<T2>&& other);
+    Ref(Ref<T2, Policy>&& other);
 
     ~Ref();
 
-    Ref(const Ref<T>& other);
+    Ref(const Ref<T, Policy>& other);
+
+    Ref(Ref<T, Policy>&& other) noexcept;
 
 public:
     Ref& operator=(std::nullptr_t);
 
-    Ref& operator=(const Ref<T>& other);
+    Ref& operator=(const Ref<T, Policy>& other);
+
+    Ref& operator=(Ref<T, Policy>&& other) noexcept;
 
     template <typename T2>
-    Ref& operator=(const Ref<T2>& other);
+    Ref& operator=(const Ref<T2, Policy>& other);
 
     template <typename T2>
-    Ref& operator=(Ref<T2>&& other);
+    Ref& operator=(Ref<T2, Policy>&& other);
 
     operator bool();
 
@@ -65,18 +169,21 @@ public:
     T& operator*();
     const T& operator*() const;
 
-    bool operator==(const Ref<T>& other) const;
+    bool operator==(const Ref<T, Policy>& other) const;
 
-    bool operator!=(const Ref<T>& other) const;
+    bool operator!=(const Ref<T, Policy>& other) const;
 
     operator T*();
     operator T*() const;
 
 public:
     template <typename... Args>
-    static Ref<T> Create(Args&&... args);
+    static Ref<T, Policy> Create(Args&&... args);
+
+    template <typename... Args>
+    static Ref<T, Policy> CreateTagged(Engine::MemoryTag tag, Args&&... args);
 
-    static Ref<T> CopyWithoutIncrement(const Ref<T>& other);
+    static Ref<T, Policy> CopyWithoutIncrement(const Ref<T, Policy>& other);
 
 public:
     T* Raw();
@@ -85,44 +192,58 @@ public:
 
     void Reset(T* instance = nullptr);
     template <typename T2>
-    Ref<T2> As() const;
+    Ref<T2, Policy> As() const;
 
-    bool EqualsObject(const Ref<T>& other);
+    bool EqualsObject(const Ref<T, Policy>& other);
 
 private:
     void IncRef() const;
     void DecRef() const;
 
-    template <class T2>
+    template <class T2, class Policy2>
     friend class Ref;
+    template <class T2>
+    friend class WeakRef;
     mutable T* m_Instance{};
 };
 
+/**
+ * Non owning reference, only valid while a Ref to the object exists.
+ */
 template <typename T>
 class WeakRef
 {
 public:
     WeakRef() = default;
-    ~WeakRef() = default;
+    ~WeakRef();
 
-    WeakRef(Ref<T> ref) { m_Instance = ref.Raw(); }
+    WeakRef(const Ref<T>& ref);
 
-    WeakRef(T* instance) { m_Instance = instance; }
+    WeakRef(T* instance);
+
+    WeakRef(const WeakRef<T>& other);
+
+    WeakRef(WeakRef<T>&& other) noexcept;
+
+public:
+    WeakRef& operator=(const WeakRef<T>& other);
+
+    WeakRef& operator=(WeakRef<T>&& other) noexcept;
 
 public:
-    bool IsValid() const { return m_Instance ? Engine::Allocator::IsLive(m_Instance) : false; }
+    bool IsValid() const;
+
+    /** Returns an empty Ref once the object is gone. */
+    Ref<T> Lock() const;
 
-    Ref<T> Lock() const
-    {
-        if (IsValid()) { return Ref<T>(m_Instance); }
-        return Ref<T>();
-    }
+    void Reset();
 
 public:
     operator bool() const { return IsValid(); }
 
 private:
     T* m_Instance = nullptr;
+    RefControlBlock* m_ControlBlock = nullptr;
 };
 
 #include <Core/Ref.impl.hpp>
\ No newline at end of file
@@ -1,56 +1,63 @@
 #pragma once
 #include <Core/Ref.hpp>
 
-template <typename T>
-Ref<T>::Ref(T* instance) : m_Instance(instance)
+template <typename T, typename Policy>
+Ref<T, Policy>::Ref(T* instance) : m_Instance(instance)
 {
     if (m_Instance)
     {
-        static_assert(std::is_base_of<RefCounted, T>::value, "Class is not RefCounted!");
-        std::lock_guard<std::mutex> lock(m);
-        Engine::Allocator::AddToAllocatedMemory(m_Instance);
+        static_assert(std::is_base_of_v<typename RefPolicyType<T, Policy>::CountedType, T>,
+                      "Class does not derive from the counter type of the policy!");
+        // Only a fresh object needs registering, one that is already referenced is tracked.
+        if (0 == m_Instance->GetRefCount()) { Engine::Allocator::AddToAllocatedMemory(m_Instance); }
         IncRef();
     }
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename T2>
-Ref<T>::Ref(const Ref<T2>& other)
+Ref<T, Policy>::Ref(const Ref<T2, Policy>& other)
 {
     m_Instance = (T*) other.m_Instance;
     IncRef();
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename T2>
-Ref<T>::Ref(Ref<T2>&& other)
+Ref<T, Policy>::Ref(Ref<T2, Policy>&& other)
 {
     m_Instance = (T*) other.m_Instance;
     other.m_Instance = nullptr;
 }
 
-template <typename T>
-Ref<T>::Ref(const Ref<T>& other) : m_Instance(other.m_Instance)
+template <typename T, typename Policy>
+Ref<T, Policy>::Ref(const Ref<T, Policy>& other) : m_Instance(other.m_Instance)
 {
     IncRef();
 }
 
-template <typename T>
-Ref<T>::~Ref()
+template <typename T, typename Policy>
+Ref<T, Policy>::Ref(Ref<T, Policy>&& other) noexcept : m_Instance(other.m_Instance)
+{
+    other.m_Instance = nullptr;
+}
+
+template <typename T, typename Policy>
+Ref<T, Policy>::~Ref()
 {
     DecRef();
 }
 
-template <typename T>
-Ref<T>& Ref<T>::operator=(std::nullptr_t)
+template <typename T, typename Policy>
+Ref<T, Policy>& Ref<T, Policy>::operator=(std::nullptr_t)
 {
     DecRef();
     m_Instance = nullptr;
     return *this;
 }
 
-template <typename T>
-Ref<T>& Ref<T>::operator=(const Ref<T>& other)
+template <typename T, typename Policy>
+Ref<T, Policy>& Ref<T, Policy>::operator=(const Ref<T, Policy>& other)
 {
     other.IncRef();
     DecRef();
@@ -59,9 +66,20 @@ Ref<T>& Ref<T>::operator=(const Ref<T>& other)
     return *this;
 }
 
-template <typename T>
+template <typename T, typename Policy>
+Ref<T, Policy>& Ref<T, Policy>::operator=(Ref<T, Policy>&& other) noexcept
+{
+    if (this == &other) { return *this; }
+    DecRef();
+
+    m_Instance = other.m_Instance;
+    other.m_Instance = nullptr;
+    return *this;
+}
+
+template <typename T, typename Policy>
 template <typename T2>
-Ref<T>& Ref<T>::operator=(const Ref<T2>& other)
+Ref<T, Policy>& Ref<T, Policy>::operator=(const Ref<T2, Policy>& other)
 {
     other.IncRef();
     DecRef();
@@ -70,9 +88,9 @@ Ref<T>& Ref<T>::operator=(const Ref<T2>& other)
     return *this;
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename T2>
-Ref<T>& Ref<T>::operator=(Ref<T2>&& other)
+Ref<T, Policy>& Ref<T, Policy>::operator=(Ref<T2, Policy>&& other)
 {
     DecRef();
 
@@ -81,132 +99,211 @@ Ref<T>& Ref<T>::operator=(Ref<T2>&& other)
     return *this;
 }
 
-template <typename T>
-Ref<T>::operator bool()
+template <typename T, typename Policy>
+Ref<T, Policy>::operator bool()
 {
     return m_Instance != nullptr;
 }
 
-template <typename T>
-Ref<T>::operator bool() const
+template <typename T, typename Policy>
+Ref<T, Policy>::operator bool() const
 {
     return m_Instance != nullptr;
 }
 
-template <typename T>
-T* Ref<T>::operator->()
+template <typename T, typename Policy>
+T* Ref<T, Policy>::operator->()
 {
     return m_Instance;
 }
 
-template <typename T>
-const T* Ref<T>::operator->() const
+template <typename T, typename Policy>
+const T* Ref<T, Policy>::operator->() const
 {
     return m_Instance;
 }
 
-template <typename T>
-T& Ref<T>::operator*()
+template <typename T, typename Policy>
+T& Ref<T, Policy>::operator*()
 {
     return *m_Instance;
 }
 
-template <typename T>
-const T& Ref<T>::operator*() const
+template <typename T, typename Policy>
+const T& Ref<T, Policy>::operator*() const
 {
     return *m_Instance;
 }
 
-template <typename T>
-bool Ref<T>::operator==(const Ref<T>& other) const
+template <typename T, typename Policy>
+bool Ref<T, Policy>::operator==(const Ref<T, Policy>& other) const
 {
     return m_Instance == other.m_Instance;
 }
 
-template <typename T>
-bool Ref<T>::operator!=(const Ref<T>& other) const
+template <typename T, typename Policy>
+bool Ref<T, Policy>::operator!=(const Ref<T, Policy>& other) const
 {
     return !(*this == other);
 }
 
-template <typename T>
-Ref<T>::operator T*()
+template <typename T, typename Policy>
+Ref<T, Policy>::operator T*()
 {
     return m_Instance;
 }
 
-template <typename T>
-Ref<T>::operator T*() const
+template <typename T, typename Policy>
+Ref<T, Policy>::operator T*() const
 {
     return m_Instance;
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename... Args>
-Ref<T> Ref<T>::Create(Args&&... args)
+Ref<T, Policy> Ref<T, Policy>::Create(Args&&... args)
 {
-    return Ref<T>(Engine::Allocator::Allocate<T>(std::forward<Args>(args)...));
+    return Ref<T, Policy>(Engine::Allocator::Allocate<T>(std::forward<Args>(args)...));
 }
 
-template <typename T>
-Ref<T> Ref<T>::CopyWithoutIncrement(const Ref<T>& other)
+template <typename T, typename Policy>
+template <typename... Args>
+Ref<T, Policy> Ref<T, Policy>::CreateTagged(Engine::MemoryTag tag, Args&&... args)
 {
-    Ref<T> result = nullptr;
-    result->m_Instance = other.m_Instance;
+    return Ref<T, Policy>(Engine::Allocator::AllocateTagged<T>(tag, std::forward<Args>(args)...));
+}
+
+template <typename T, typename Policy>
+Ref<T, Policy> Ref<T, Policy>::CopyWithoutIncrement(const Ref<T, Policy>& other)
+{
+    Ref<T, Policy> result = nullptr;
+    result.m_Instance = other.m_Instance;
     return result;
 }
 
-template <typename T>
-T* Ref<T>::Raw()
+template <typename T, typename Policy>
+T* Ref<T, Policy>::Raw()
 {
     return m_Instance;
 }
 
-template <typename T>
-const T* Ref<T>::Raw() const
+template <typename T, typename Policy>
+const T* Ref<T, Policy>::Raw() const
 {
     return m_Instance;
 }
 
-template <typename T>
-void Ref<T>::Reset(T* instance)
+template <typename T, typename Policy>
+void Ref<T, Policy>::Reset(T* instance)
 {
     DecRef();
     m_Instance = instance;
 }
 
-template <typename T>
+template <typename T, typename Policy>
 template <typename T2>
-Ref<T2> Ref<T>::As() const
+Ref<T2, Policy> Ref<T, Policy>::As() const
 {
-    return Ref<T2>(*this);
+    return Ref<T2, Policy>(*this);
 }
 
-template <typename T>
-bool Ref<T>::EqualsObject(const Ref<T>& other)
+template <typename T, typename Policy>
+bool Ref<T, Policy>::EqualsObject(const Ref<T, Policy>& other)
 {
     if (!m_Instance || !other.m_Instance) return false;
 
     return *m_Instance == *other.m_Instance;
 }
 
-template <typename T>
-void Ref<T>::IncRef() const
+template <typename T, typename Policy>
+void Ref<T, Policy>::IncRef() const
 {
-    if (m_Instance) { m_Instance->IncRefCount(); }
+    if (m_Instance) { RefPolicyType<T, Policy>::IncRef(m_Instance); }
 }
 
-template <typename T>
-void Ref<T>::DecRef() const
+template <typename T, typename Policy>
+void Ref<T, Policy>::DecRef() const
 {
-    if (m_Instance)
+    if (m_Instance && RefPolicyType<T, Policy>::DecRef(m_Instance))
     {
-        m_Instance->DecRefCount();
-        if (m_Instance->GetRefCount() == 0)
-        {
-            std::lock_guard<std::mutex> lock(m);
-            Engine::Allocator::Deallocate(m_Instance);
-            m_Instance = nullptr;
-        }
+        Engine::Allocator::Deallocate(m_Instance);
+        m_Instance = nullptr;
     }
-}
\ No newline at end of file
+}
+
+template <typename T>
+WeakRef<T>::~WeakRef()
+{
+    Reset();
+}
+
+template <typename T>
+WeakRef<T>::WeakRef(const Ref<T>& ref) : WeakRef(ref.m_Instance)
+{
+}
+
+template <typename T>
+WeakRef<T>::WeakRef(T* instance) : m_Instance(instance)
+{
+    static_assert(std::is_base_of_v<RefCounted, T>, "Weak references need a RefCounted object!");
+    if (m_Instance) { m_ControlBlock = m_Instance->AcquireControlBlock(); }
+}
+
+template <typename T>
+WeakRef<T>::WeakRef(const WeakRef<T>& other) : m_Instance(other.m_Instance), m_ControlBlock(other.m_ControlBlock)
+{
+    if (m_ControlBlock) { m_ControlBlock->IncWeakCount(); }
+}
+
+template <typename T>
+WeakRef<T>::WeakRef(WeakRef<T>&& other) noexcept : m_Instance(other.m_Instance), m_ControlBlock(other.m_ControlBlock)
+{
+    other.m_Instance = nullptr;
+    other.m_ControlBlock = nullptr;
+}
+
+template <typename T>
+WeakRef<T>& WeakRef<T>::operator=(const WeakRef<T>& other)
+{
+    if (other.m_ControlBlock) { other.m_ControlBlock->IncWeakCount(); }
+    Reset();
+
+    m_Instance = other.m_Instance;
+    m_ControlBlock = other.m_ControlBlock;
+    return *this;
+}
+
+template <typename T>
+WeakRef<T>& WeakRef<T>::operator=(WeakRef<T>&& other) noexcept
+{
+    if (this == &other) { return *this; }
+    Reset();
+
+    m_Instance = other.m_Instance;
+    m_ControlBlock = other.m_ControlBlock;
+    other.m_Instance = nullptr;
+    other.m_ControlBlock = nullptr;
+    return *this;
+}
+
+template <typename T>
+bool WeakRef<T>::IsValid() const
+{
+    return m_ControlBlock ? m_ControlBlock->StrongCount.load(std::memory_order_acquire) > 0 : false;
+}
+
+template <typename T>
+Ref<T> WeakRef<T>::Lock() const
+{
+    Ref<T> result = nullptr;
+    if (m_ControlBlock && m_ControlBlock->TryIncStrongCount()) { result.m_Instance = m_Instance; }
+    return result;
+}
+
+template <typename T>
+void WeakRef<T>::Reset()
+{
+    if (m_ControlBlock) { m_ControlBlock->DecWeakCount(); }
+    m_Instance = nullptr;
+    m_ControlBlock = nullptr;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * ScratchStack class implementation
+ */
+
+#include "ScratchStack.hpp"
+
+#include <algorithm>
+
+namespace Engine
+{
+    ScratchStack& ScratchStack::Get()
+    {
+        thread_local ScratchStack stack;
+        if (!stack.m_Arena.IsInitialized())
+        {
+            VirtualArenaSpec spec;
+            spec.ReserveSize = ReserveSize;
+            spec.CommitGranularity = CommitGranularity;
+            spec.Tag = MemoryTag::Transient;
+            stack.m_Arena.Init(spec);
+        }
+        return stack;
+    }
+
+    void* ScratchStack::Allocate(size_t size, size_t alignment)
+    {
+        auto memory = m_Arena.Allocate(size, alignment);
+        m_Peak = std::max(m_Peak, m_Arena.GetUsed());
+        return memory;
+    }
+
+    size_t ScratchStack::GetMarker() const { return m_Arena.GetMarker(); }
+
+    void ScratchStack::Rewind(size_t marker) { m_Arena.Rewind(marker); }
+
+    size_t ScratchStack::GetUsed() const { return m_Arena.GetUsed(); }
+
+    size_t ScratchStack::GetPeak() const { return m_Peak; }
+
+    size_t ScratchStack::GetCommitted() const { return m_Arena.GetCommitted(); }
+}// namespace Engine
@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * ScratchStack class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include <Core/VirtualArena.hpp>
+
+namespace Engine
+{
+    /**
+     * Per thread LIFO allocator for temporary work.
+     *
+     * Memory is taken from a thread local VirtualArena and handed back in bulk by rolling back to a marker, usually
+     * through ScratchScope. Anything allocated inside a scope is invalid once the scope ends, so results that outlive
+     * it have to be copied out. Objects are never destructed, only trivially destructible types can be created.
+     */
+    class ScratchStack
+    {
+    public:
+        static constexpr size_t ReserveSize = 64 * 1024 * 1024;
+        static constexpr size_t CommitGranularity = 64 * 1024;
+
+    public:
+        ScratchStack() = default;
+        ~ScratchStack() = default;
+
+        ScratchStack(const ScratchStack&) = delete;
+        ScratchStack& operator=(const ScratchStack&) = delete;
+
+    public:
+        /** The calling thread's stack, reserved on first use. */
+        static ScratchStack& Get();
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        /** Value initialized, returns an empty span when the stack is exhausted. */
+        template <typename T>
+        std::span<T> AllocateArray(size_t count);
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args);
+
+        size_t GetMarker() const;
+
+        void Rewind(size_t marker);
+
+    public:
+        size_t GetUsed() const;
+
+        size_t GetPeak() const;
+
+        size_t GetCommitted() const;
+
+    private:
+        VirtualArena m_Arena;
+        size_t m_Peak{};
+    };
+
+    /**
+     * Rolls the thread's scratch stack back to where it was on construction.
+     */
+    class ScratchScope
+    {
+    public:
+        ScratchScope() : m_Stack(ScratchStack::Get()), m_Marker(m_Stack.GetMarker()) {}
+
+        ~ScratchScope() { m_Stack.Rewind(m_Marker); }
+
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+
+    public:
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            return m_Stack.Allocate(size, alignment);
+        }
+
+        template <typename T>
+        std::span<T> AllocateArray(size_t count)
+        {
+            return m_Stack.AllocateArray<T>(count);
+        }
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args)
+        {
+            return m_Stack.Create<T>(std::forward<Args>(args)...);
+        }
+
+    private:
+        ScratchStack& m_Stack;
+        size_t m_Marker;
+    };
+}// namespace Engine
+
+#include "ScratchStack.impl.hpp"
@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * ScratchStack templated functions implementation
+ */
+
+#include <memory>
+#include <new>
+#include <utility>
+#include "ScratchStack.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    std::span<T> ScratchStack::AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is never destructed!");
+        auto memory = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        if (nullptr == memory) { return {}; }
+
+        std::uninitialized_value_construct_n(memory, count);
+        return {memory, count};
+    }
+
+    template <typename T, typename... Args>
+    T* ScratchStack::Create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is never destructed!");
+        auto memory = Allocate(sizeof(T), alignof(T));
+        return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+}// namespace Engine
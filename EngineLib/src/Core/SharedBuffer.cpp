@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * SharedBuffer class implementation
+ */
+
+#include "SharedBuffer.hpp"
+
+#include <cassert>
+#include <cstring>
+
+namespace Engine
+{
+    SharedBuffer::SharedBuffer(Buffer&& buffer) : m_Storage(Ref<Storage>::Create(std::move(buffer))) {}
+
+    SharedBuffer SharedBuffer::Copy(BufferView view) { return SharedBuffer(Buffer::Copy(view)); }
+
+    BufferView SharedBuffer::GetView() const { return m_Storage ? m_Storage->Bytes.GetView() : BufferView{}; }
+
+    uint32_t SharedBuffer::GetSize() const { return m_Storage ? m_Storage->Bytes.GetSize() : 0; }
+
+    bool SharedBuffer::IsUnique() const { return m_Storage && 1 == m_Storage->GetRefCount(); }
+
+    uint8_t* SharedBuffer::GetMutableData()
+    {
+        if (!m_Storage) { return nullptr; }
+        if (!IsUnique()) { m_Storage = Ref<Storage>::Create(Buffer::Copy(m_Storage->Bytes.GetView())); }
+        return m_Storage->Bytes.Data;
+    }
+
+    void SharedBuffer::Write(BufferView data, uint32_t offset)
+    {
+        assert(offset + data.GetSize() <= GetSize());
+        if (data.Empty()) { return; }
+        memcpy(GetMutableData() + offset, data.Data(), data.GetSize());
+    }
+
+    void SharedBuffer::Reset() { m_Storage = nullptr; }
+}// namespace Engine
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * SharedBuffer class definition
+ */
+
+#include <cstdint>
+#include <utility>
+
+#include <Core/Buffer.hpp>
+#include <Core/BufferView.hpp>
+#include <Core/Ref.hpp>
+
+namespace Engine
+{
+    /**
+     * Reference counted, copy on write byte payload.
+     *
+     * Copies share the bytes, reading through GetView() never copies. The first write through a copy that is not
+     * the only owner detaches it onto its own copy of the bytes, so other owners never see the change.
+     */
+    class SharedBuffer
+    {
+    public:
+        SharedBuffer() = default;
+
+        explicit SharedBuffer(Buffer&& buffer);
+
+    public:
+        static SharedBuffer Copy(BufferView view);
+
+        BufferView GetView() const;
+
+        uint32_t GetSize() const;
+
+        bool IsUnique() const;
+
+        /** Detaches from other owners first, the pointer is valid until the next copy on write or Reset(). */
+        uint8_t* GetMutableData();
+
+        void Write(BufferView data, uint32_t offset = 0);
+
+        void Reset();
+
+    public:
+        operator BufferView() const { return GetView(); }
+
+        explicit operator bool() const { return GetSize() > 0; }
+
+    private:
+        struct Storage: public RefCounted {
+            explicit Storage(Buffer&& bytes) : Bytes(std::move(bytes)) {}
+
+            Buffer Bytes;
+        };
+
+    private:
+        Ref<Storage> m_Storage;
+    };
+}// namespace Engine
@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * SlotMap class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Engine
+{
+    /**
+     * Index into a SlotMap plus the generation of the slot when it was handed out. Erasing bumps the slot
+     * generation, so handles to erased values are detected instead of aliasing whatever reuses the slot.
+     * Default constructed handles are invalid, generations start at 1.
+     */
+    template <typename T>
+    struct Handle {
+        static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t Index = InvalidIndex;
+        uint32_t Generation = 0;
+
+        bool IsValid() const { return 0 != Generation; }
+
+        explicit operator bool() const { return IsValid(); }
+
+        bool operator==(const Handle<T>& other) const = default;
+    };
+
+    /**
+     * Dense storage with generational handles.
+     *
+     * Values are packed in one array so iteration is linear, erase moves the last value into the hole. Slots map a
+     * handle index to the value position and keep a free list, insert, erase and lookup are O(1).
+     *
+     * Not thread safe, handles themselves are trivially copyable and can be passed around freely.
+     */
+    template <typename T>
+    class SlotMap
+    {
+    public:
+        using HandleType = Handle<T>;
+        using Iterator = typename std::vector<T>::iterator;
+        using ConstIterator = typename std::vector<T>::const_iterator;
+
+    public:
+        SlotMap() = default;
+        ~SlotMap() = default;
+
+    public:
+        HandleType Insert(const T& value);
+
+        HandleType Insert(T&& value);
+
+        template <typename... Args>
+        HandleType Emplace(Args&&... args);
+
+        /** Returns false for stale or invalid handles. */
+        bool Erase(HandleType handle);
+
+        /** Returns nullptr for stale or invalid handles. */
+        T* Get(HandleType handle);
+
+        const T* Get(HandleType handle) const;
+
+        bool Contains(HandleType handle) const;
+
+        /** Handle of the value at a dense position, pairs with iteration. */
+        HandleType GetHandle(size_t denseIndex) const;
+
+        void Clear();
+
+        void Reserve(size_t capacity);
+
+    public:
+        size_t Size() const { return m_Values.size(); }
+
+        bool Empty() const { return m_Values.empty(); }
+
+        Iterator begin() { return m_Values.begin(); }
+
+        Iterator end() { return m_Values.end(); }
+
+        ConstIterator begin() const { return m_Values.begin(); }
+
+        ConstIterator end() const { return m_Values.end(); }
+
+    private:
+        struct Slot {
+            /** Position in m_Values while occupied, next free slot while free. */
+            uint32_t Index{};
+            uint32_t Generation{1};
+        };
+
+    private:
+        HandleType AllocateSlot();
+
+        const Slot* FindSlot(HandleType handle) const;
+
+        static uint32_t NextGeneration(uint32_t generation);
+
+    private:
+        std::vector<T> m_Values;
+        std::vector<uint32_t> m_DenseToSlot;
+        std::vector<Slot> m_Slots;
+        uint32_t m_FreeHead{HandleType::InvalidIndex};
+    };
+}// namespace Engine
+
+template <typename T>
+struct std::hash<Engine::Handle<T>> {
+    size_t operator()(const Engine::Handle<T>& handle) const noexcept
+    {
+        return std::hash<uint64_t>()((static_cast<uint64_t>(handle.Generation) << 32) | handle.Index);
+    }
+};
+
+#include "SlotMap.impl.hpp"
@@ -0,0 +1,155 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * SlotMap templated functions implementation
+ */
+
+#include <utility>
+#include "SlotMap.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    Handle<T> SlotMap<T>::Insert(const T& value)
+    {
+        auto handle = AllocateSlot();
+        m_Values.push_back(value);
+        return handle;
+    }
+
+    template <typename T>
+    Handle<T> SlotMap<T>::Insert(T&& value)
+    {
+        auto handle = AllocateSlot();
+        m_Values.push_back(std::move(value));
+        return handle;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    Handle<T> SlotMap<T>::Emplace(Args&&... args)
+    {
+        auto handle = AllocateSlot();
+        m_Values.emplace_back(std::forward<Args>(args)...);
+        return handle;
+    }
+
+    template <typename T>
+    bool SlotMap<T>::Erase(HandleType handle)
+    {
+        if (nullptr == FindSlot(handle)) { return false; }
+
+        auto& slot = m_Slots[handle.Index];
+        auto denseIndex = slot.Index;
+        auto lastIndex = static_cast<uint32_t>(m_Values.size() - 1);
+        if (denseIndex != lastIndex)
+        {
+            m_Values[denseIndex] = std::move(m_Values[lastIndex]);
+            m_DenseToSlot[denseIndex] = m_DenseToSlot[lastIndex];
+            m_Slots[m_DenseToSlot[denseIndex]].Index = denseIndex;
+        }
+        m_Values.pop_back();
+        m_DenseToSlot.pop_back();
+
+        slot.Generation = NextGeneration(slot.Generation);
+        slot.Index = m_FreeHead;
+        m_FreeHead = handle.Index;
+        return true;
+    }
+
+    template <typename T>
+    T* SlotMap<T>::Get(HandleType handle)
+    {
+        auto slot = FindSlot(handle);
+        return slot ? &m_Values[slot->Index] : nullptr;
+    }
+
+    template <typename T>
+    const T* SlotMap<T>::Get(HandleType handle) const
+    {
+        auto slot = FindSlot(handle);
+        return slot ? &m_Values[slot->Index] : nullptr;
+    }
+
+    template <typename T>
+    bool SlotMap<T>::Contains(HandleType handle) const
+    {
+        return nullptr != FindSlot(handle);
+    }
+
+    template <typename T>
+    Handle<T> SlotMap<T>::GetHandle(size_t denseIndex) const
+    {
+        if (denseIndex >= m_DenseToSlot.size()) { return {}; }
+
+        auto slotIndex = m_DenseToSlot[denseIndex];
+        return {slotIndex, m_Slots[slotIndex].Generation};
+    }
+
+    template <typename T>
+    void SlotMap<T>::Clear()
+    {
+        for (auto slotIndex: m_DenseToSlot)
+        {
+            auto& slot = m_Slots[slotIndex];
+            slot.Generation = NextGeneration(slot.Generation);
+            slot.Index = m_FreeHead;
+            m_FreeHead = slotIndex;
+        }
+        m_Values.clear();
+        m_DenseToSlot.clear();
+    }
+
+    template <typename T>
+    void SlotMap<T>::Reserve(size_t capacity)
+    {
+        m_Values.reserve(capacity);
+        m_DenseToSlot.reserve(capacity);
+        m_Slots.reserve(capacity);
+    }
+
+    template <typename T>
+    Handle<T> SlotMap<T>::AllocateSlot()
+    {
+        auto denseIndex = static_cast<uint32_t>(m_Values.size());
+
+        uint32_t slotIndex;
+        if (HandleType::InvalidIndex != m_FreeHead)
+        {
+            slotIndex = m_FreeHead;
+            m_FreeHead = m_Slots[slotIndex].Index;
+        }
+        else
+        {
+            slotIndex = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.emplace_back();
+        }
+
+        m_Slots[slotIndex].Index = denseIndex;
+        m_DenseToSlot.push_back(slotIndex);
+        return {slotIndex, m_Slots[slotIndex].Generation};
+    }
+
+    template <typename T>
+    auto SlotMap<T>::FindSlot(HandleType handle) const -> const Slot*
+    {
+        if (handle.Index >= m_Slots.size()) { return nullptr; }
+
+        auto& slot = m_Slots[handle.Index];
+        return slot.Generation == handle.Generation ? &slot : nullptr;
+    }
+
+    template <typename T>
+    uint32_t SlotMap<T>::NextGeneration(uint32_t generation)
+    {
+        // Zero is reserved for invalid handles.
+        return 0 == ++generation ? 1 : generation;
+    }
+}// namespace Engine
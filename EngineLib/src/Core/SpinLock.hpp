@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * SpinLock class definition
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace Engine
+{
+    /**
+     * Test-and-test-and-set lock for very short critical sections (a few hash map operations).
+     * Satisfies the standard Lockable requirements so it can be used with std::lock_guard.
+     */
+    class SpinLock
+    {
+    public:
+        SpinLock() = default;
+        ~SpinLock() = default;
+
+        SpinLock(const SpinLock&) = delete;
+        SpinLock& operator=(const SpinLock&) = delete;
+
+    public:
+        void lock()
+        {
+            while (m_Locked.exchange(true, std::memory_order_acquire))
+            {
+                for (uint32_t spin = 0; m_Locked.load(std::memory_order_relaxed); spin++)
+                {
+                    if (spin < MaxSpins) { Pause(); }
+                    else { std::this_thread::yield(); }
+                }
+            }
+        }
+
+        bool try_lock() { return !m_Locked.exchange(true, std::memory_order_acquire); }
+
+        void unlock() { m_Locked.store(false, std::memory_order_release); }
+
+    private:
+        static constexpr uint32_t MaxSpins = 64;
+
+        static void Pause()
+        {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#endif
+        }
+
+    private:
+        std::atomic<bool> m_Locked{};
+    };
+}// namespace Engine
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * StringId class implementation
+ */
+
+#include "StringId.hpp"
+#include "Log.hpp"
+#include "VirtualArena.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Engine
+{
+    namespace
+    {
+        struct StringTable {
+            static constexpr size_t ReserveSize = 64 * 1024 * 1024;
+
+            std::shared_mutex Mutex;
+            std::unordered_map<uint64_t, std::string_view> Strings;
+            // Text is copied into an arena whose base never moves, so the views above stay valid.
+            VirtualArena Storage;
+        };
+
+        StringTable& GetTable()
+        {
+            static StringTable table;
+            return table;
+        }
+    }// namespace
+
+    StringId StringId::Intern(std::string_view text)
+    {
+        StringId id(text);
+        auto& table = GetTable();
+
+        {
+            std::shared_lock lock(table.Mutex);
+            auto it = table.Strings.find(id.m_Value);
+            if (it != table.Strings.end())
+            {
+                if (it->second != text)
+                {
+                    LOG_ERROR("StringId collision between \"%s\" and \"%.*s\"\n", it->second.data(),
+                              static_cast<int>(text.size()), text.data());
+                }
+                assert(it->second == text);
+                return id;
+            }
+        }
+
+        std::unique_lock lock(table.Mutex);
+        if (table.Strings.contains(id.m_Value)) { return id; }
+
+        if (!table.Storage.IsInitialized())
+        {
+            VirtualArenaSpec spec;
+            spec.ReserveSize = StringTable::ReserveSize;
+            table.Storage.Init(spec);
+        }
+
+        auto* storage = table.Storage.AllocateArray<char>(text.size() + 1);
+        if (!storage)
+        {
+            LOG_ERROR("StringId table is full, \"%.*s\" is not interned\n", static_cast<int>(text.size()),
+                      text.data());
+            return id;
+        }
+        memcpy(storage, text.data(), text.size());
+        storage[text.size()] = '\0';
+        table.Strings.emplace(id.m_Value, std::string_view{storage, text.size()});
+        return id;
+    }
+
+    size_t StringId::GetInternedCount()
+    {
+        auto& table = GetTable();
+        std::shared_lock lock(table.Mutex);
+        return table.Strings.size();
+    }
+
+    std::string_view StringId::GetString() const
+    {
+        auto& table = GetTable();
+        std::shared_lock lock(table.Mutex);
+        auto it = table.Strings.find(m_Value);
+        return it != table.Strings.end() ? it->second : std::string_view{};
+    }
+}// namespace Engine
@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * StringId class definition
+ */
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <Core/Hash.hpp>
+
+namespace Engine
+{
+    /**
+     * 64 bit identifier of a name, equality and ordering are integer compares.
+     *
+     * The value is the hash of the text, so the same name gives the same id everywhere without a lookup and ids of
+     * literals are computed at compile time. Intern() additionally records the text in a global table, which is what
+     * GetString() reads back for logs and debugging. The table is thread safe and never shrinks.
+     */
+    class StringId
+    {
+    public:
+        constexpr StringId() = default;
+
+        constexpr StringId(std::string_view text) : m_Value(Hash::Compute(text)) {}
+
+        // Both convert in one step, through string_view a literal or std::string would need two conversions.
+        constexpr StringId(const char* text) : StringId(std::string_view(text)) {}
+
+        constexpr StringId(const std::string& text) : StringId(std::string_view(text)) {}
+
+    public:
+        static StringId Intern(std::string_view text);
+
+        static constexpr StringId FromValue(uint64_t value)
+        {
+            StringId id;
+            id.m_Value = value;
+            return id;
+        }
+
+        static size_t GetInternedCount();
+
+    public:
+        constexpr uint64_t GetValue() const { return m_Value; }
+
+        constexpr bool IsValid() const { return 0 != m_Value; }
+
+        /** Null terminated text of an interned id, an empty view when it was never interned. */
+        std::string_view GetString() const;
+
+        constexpr auto operator<=>(const StringId&) const = default;
+
+    private:
+        uint64_t m_Value{};
+    };
+
+    namespace Literals
+    {
+        consteval StringId operator""_sid(const char* text, size_t size) { return StringId(std::string_view{text, size}); }
+    }// namespace Literals
+}// namespace Engine
+
+template <>
+struct std::hash<Engine::StringId> {
+    size_t operator()(Engine::StringId id) const noexcept { return static_cast<size_t>(id.GetValue()); }
+};
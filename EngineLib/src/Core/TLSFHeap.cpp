@@ -0,0 +1,251 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * TLSFHeap class implementation
+ */
+
+#include "TLSFHeap.hpp"
+#include <Core/Log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <new>
+
+namespace Engine
+{
+    TLSFHeap::~TLSFHeap() { Destroy(); }
+
+    void TLSFHeap::Init(size_t regionSize)
+    {
+        std::lock_guard<SpinLock> lock(m_Lock);
+        m_RegionSize = std::max(regionSize, SmallBlockSize * 4);
+    }
+
+    void TLSFHeap::Destroy()
+    {
+        std::lock_guard<SpinLock> lock(m_Lock);
+        for (auto& [region, size]: m_Regions) { ::operator delete(region, std::align_val_t(Alignment)); }
+        m_Regions.clear();
+
+        m_FirstLevelBitmap = 0;
+        m_SecondLevelBitmap = {};
+        m_FreeBlocks = {};
+        m_ReservedBytes = 0;
+        m_UsedBytes = 0;
+        m_AllocationCount = 0;
+    }
+
+    void* TLSFHeap::Allocate(size_t size)
+    {
+        size = std::max((size + Alignment - 1) & ~(Alignment - 1), MinBlockSize);
+
+        std::lock_guard<SpinLock> lock(m_Lock);
+        auto block = FindSuitableBlock(size);
+        if (nullptr == block) { block = AddRegion(size); }
+        if (nullptr == block) { return nullptr; }
+        RemoveFreeBlock(block);
+
+        // Split off the tail when it can hold a block of its own.
+        auto blockSize = block->GetSize();
+        if (blockSize >= size + HeaderSize + MinBlockSize)
+        {
+            auto remainder = reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ToPayload(block)) + size);
+            remainder->PrevPhysical = block;
+            remainder->SizeAndFlags = blockSize - size - HeaderSize;
+            remainder->SetFree(true);
+            NextPhysical(remainder)->PrevPhysical = remainder;
+            block->SetSize(size);
+            InsertFreeBlock(remainder);
+        }
+
+        block->SetFree(false);
+        m_UsedBytes += block->GetSize();
+        m_HighWaterMark = std::max(m_HighWaterMark, m_UsedBytes);
+        m_AllocationCount++;
+        return ToPayload(block);
+    }
+
+    void TLSFHeap::Deallocate(void* memory)
+    {
+        if (nullptr == memory) { return; }
+
+        std::lock_guard<SpinLock> lock(m_Lock);
+        auto block = FromPayload(memory);
+        m_UsedBytes -= block->GetSize();
+        m_AllocationCount--;
+        block->SetFree(true);
+
+        auto next = NextPhysical(block);
+        if (next->IsFree())
+        {
+            RemoveFreeBlock(next);
+            block->SetSize(block->GetSize() + HeaderSize + next->GetSize());
+            NextPhysical(block)->PrevPhysical = block;
+        }
+
+        auto previous = block->PrevPhysical;
+        if (previous && previous->IsFree())
+        {
+            RemoveFreeBlock(previous);
+            previous->SetSize(previous->GetSize() + HeaderSize + block->GetSize());
+            NextPhysical(previous)->PrevPhysical = previous;
+            block = previous;
+        }
+
+        InsertFreeBlock(block);
+    }
+
+    TLSFHeapStats TLSFHeap::GetStats()
+    {
+        std::lock_guard<SpinLock> lock(m_Lock);
+
+        TLSFHeapStats stats{};
+        stats.ReservedBytes = m_ReservedBytes;
+        stats.UsedBytes = m_UsedBytes;
+        stats.HighWaterMark = m_HighWaterMark;
+        stats.RegionCount = m_Regions.size();
+        stats.AllocationCount = m_AllocationCount;
+
+        for (auto& secondLevel: m_FreeBlocks)
+        {
+            for (auto block: secondLevel)
+            {
+                for (; block; block = block->NextFree)
+                {
+                    stats.FreeBytes += block->GetSize();
+                    stats.LargestFreeBlock = std::max(stats.LargestFreeBlock, block->GetSize());
+                }
+            }
+        }
+
+        if (stats.FreeBytes > 0)
+        {
+            stats.Fragmentation = 1.0 - double(stats.LargestFreeBlock) / double(stats.FreeBytes);
+        }
+        return stats;
+    }
+
+    void TLSFHeap::Mapping(size_t size, uint32_t& firstLevel, uint32_t& secondLevel)
+    {
+        if (size < SmallBlockSize)
+        {
+            firstLevel = 0;
+            secondLevel = static_cast<uint32_t>(size / (SmallBlockSize / SecondLevelCount));
+            return;
+        }
+
+        auto highestBit = static_cast<uint32_t>(std::bit_width(size) - 1);
+        secondLevel = static_cast<uint32_t>(size >> (highestBit - SecondLevelBits)) ^ SecondLevelCount;
+        firstLevel = highestBit - (FirstLevelShift - 1);
+    }
+
+    void* TLSFHeap::ToPayload(BlockHeader* block) { return reinterpret_cast<uint8_t*>(block) + HeaderSize; }
+
+    TLSFHeap::BlockHeader* TLSFHeap::FromPayload(void* memory)
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(memory) - HeaderSize);
+    }
+
+    TLSFHeap::BlockHeader* TLSFHeap::NextPhysical(BlockHeader* block)
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ToPayload(block)) + block->GetSize());
+    }
+
+    size_t TLSFHeap::RoundUpToBin(size_t size)
+    {
+        if (size < SmallBlockSize) { return size; }
+        return size + (size_t(1) << (std::bit_width(size) - 1 - SecondLevelBits)) - 1;
+    }
+
+    TLSFHeap::BlockHeader* TLSFHeap::FindSuitableBlock(size_t size)
+    {
+        // Round up to the next bin so every block in the bin found is large enough.
+        uint32_t firstLevel{}, secondLevel{};
+        Mapping(RoundUpToBin(size), firstLevel, secondLevel);
+        if (firstLevel >= FirstLevelCount) { return nullptr; }
+
+        auto secondLevelMap = m_SecondLevelBitmap[firstLevel] & (~0u << secondLevel);
+        if (0 == secondLevelMap)
+        {
+            auto firstLevelMap = firstLevel + 1 < FirstLevelCount ? m_FirstLevelBitmap & (~0u << (firstLevel + 1)) : 0;
+            if (0 == firstLevelMap) { return nullptr; }
+
+            firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+            secondLevelMap = m_SecondLevelBitmap[firstLevel];
+        }
+        secondLevel = static_cast<uint32_t>(std::countr_zero(secondLevelMap));
+
+        return m_FreeBlocks[firstLevel][secondLevel];
+    }
+
+    void TLSFHeap::InsertFreeBlock(BlockHeader* block)
+    {
+        uint32_t firstLevel{}, secondLevel{};
+        Mapping(block->GetSize(), firstLevel, secondLevel);
+
+        auto& head = m_FreeBlocks[firstLevel][secondLevel];
+        block->PrevFree = nullptr;
+        block->NextFree = head;
+        if (head) { head->PrevFree = block; }
+        head = block;
+
+        m_FirstLevelBitmap |= 1u << firstLevel;
+        m_SecondLevelBitmap[firstLevel] |= 1u << secondLevel;
+    }
+
+    void TLSFHeap::RemoveFreeBlock(BlockHeader* block)
+    {
+        uint32_t firstLevel{}, secondLevel{};
+        Mapping(block->GetSize(), firstLevel, secondLevel);
+
+        if (block->NextFree) { block->NextFree->PrevFree = block->PrevFree; }
+        if (block->PrevFree) { block->PrevFree->NextFree = block->NextFree; }
+
+        auto& head = m_FreeBlocks[firstLevel][secondLevel];
+        if (head == block)
+        {
+            head = block->NextFree;
+            if (nullptr == head)
+            {
+                m_SecondLevelBitmap[firstLevel] &= ~(1u << secondLevel);
+                if (0 == m_SecondLevelBitmap[firstLevel]) { m_FirstLevelBitmap &= ~(1u << firstLevel); }
+            }
+        }
+    }
+
+    TLSFHeap::BlockHeader* TLSFHeap::AddRegion(size_t minimumSize)
+    {
+        // One free block spanning the region followed by a zero sized used sentinel that stops merging. Sized for the
+        // rounded up bin, so once the region is merged back whole, FindSuitableBlock finds it for the same request.
+        auto regionSize = std::max(m_RegionSize, RoundUpToBin(minimumSize) + HeaderSize * 2 + Alignment);
+        regionSize = (regionSize + Alignment - 1) & ~(Alignment - 1);
+
+        auto region = ::operator new(regionSize, std::align_val_t(Alignment), std::nothrow);
+        if (nullptr == region)
+        {
+            LOG_ERROR("TLSF heap could not reserve %zuB region!\n", regionSize);
+            return nullptr;
+        }
+        m_Regions.emplace_back(region, regionSize);
+        m_ReservedBytes += regionSize;
+
+        auto block = static_cast<BlockHeader*>(region);
+        block->PrevPhysical = nullptr;
+        block->SizeAndFlags = regionSize - HeaderSize * 2;
+        block->SetFree(true);
+
+        auto sentinel = NextPhysical(block);
+        sentinel->PrevPhysical = block;
+        sentinel->SizeAndFlags = 0;
+
+        InsertFreeBlock(block);
+        LOG_MEMORY_ALLOC("TLSF heap reserved %zuB region\n", regionSize);
+        return block;
+    }
+}// namespace Engine
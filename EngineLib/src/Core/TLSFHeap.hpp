@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * TLSFHeap class definition
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Core/SpinLock.hpp>
+
+namespace Engine
+{
+    struct TLSFHeapStats {
+        size_t ReservedBytes{};
+        size_t UsedBytes{};
+        size_t FreeBytes{};
+        size_t HighWaterMark{};
+        size_t LargestFreeBlock{};
+        size_t RegionCount{};
+        size_t AllocationCount{};
+
+        /** 1 - largest free block / free bytes, 0 when all free memory is one block. */
+        double Fragmentation{};
+    };
+
+    /**
+     * Two-Level Segregated Fit heap.
+     *
+     * Free blocks are binned by the position of their highest set bit and then into 32 linear sub ranges, two
+     * bitmaps find a fitting non-empty bin with a couple of bit scans, so allocate and free are O(1). Neighbouring
+     * free blocks are merged on free. Memory comes from large regions that are only given back on Destroy().
+     */
+    class TLSFHeap
+    {
+    public:
+        static constexpr size_t Alignment = 16;
+        static constexpr size_t DefaultRegionSize = 64 * 1024 * 1024;
+
+    public:
+        TLSFHeap() = default;
+        ~TLSFHeap();
+
+        TLSFHeap(const TLSFHeap&) = delete;
+        TLSFHeap& operator=(const TLSFHeap&) = delete;
+
+    public:
+        void Init(size_t regionSize = DefaultRegionSize);
+
+        void Destroy();
+
+        void* Allocate(size_t size);
+
+        void Deallocate(void* memory);
+
+        TLSFHeapStats GetStats();
+
+    private:
+        static constexpr uint32_t SecondLevelBits = 5;
+        static constexpr uint32_t SecondLevelCount = 1u << SecondLevelBits;
+        static constexpr uint32_t AlignmentBits = 4;
+        static constexpr uint32_t FirstLevelShift = SecondLevelBits + AlignmentBits;
+        static constexpr uint32_t FirstLevelMax = 40;
+        static constexpr uint32_t FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+        static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+
+        struct BlockHeader {
+            BlockHeader* PrevPhysical;
+            size_t SizeAndFlags;
+
+            // Only valid while the block is free, they overlap the first bytes of the payload.
+            BlockHeader* NextFree;
+            BlockHeader* PrevFree;
+
+            size_t GetSize() const { return SizeAndFlags & ~size_t(1); }
+
+            bool IsFree() const { return SizeAndFlags & 1; }
+
+            void SetSize(size_t size) { SizeAndFlags = size | (SizeAndFlags & 1); }
+
+            void SetFree(bool free) { SizeAndFlags = GetSize() | size_t(free); }
+        };
+
+        static constexpr size_t HeaderSize = offsetof(BlockHeader, NextFree);
+        static constexpr size_t MinBlockSize = sizeof(BlockHeader) - HeaderSize;
+
+    private:
+        static void Mapping(size_t size, uint32_t& firstLevel, uint32_t& secondLevel);
+
+        /** Smallest size whose bin only holds blocks of at least size bytes. */
+        static size_t RoundUpToBin(size_t size);
+
+        static void* ToPayload(BlockHeader* block);
+
+        static BlockHeader* FromPayload(void* memory);
+
+        static BlockHeader* NextPhysical(BlockHeader* block);
+
+        BlockHeader* FindSuitableBlock(size_t size);
+
+        void InsertFreeBlock(BlockHeader* block);
+
+        void RemoveFreeBlock(BlockHeader* block);
+
+        /** Returns the region's free block, nullptr when the memory could not be reserved. */
+        BlockHeader* AddRegion(size_t minimumSize);
+
+    private:
+        SpinLock m_Lock;
+        uint32_t m_FirstLevelBitmap{};
+        std::array<uint32_t, FirstLevelCount> m_SecondLevelBitmap{};
+        std::array<std::array<BlockHeader*, SecondLevelCount>, FirstLevelCount> m_FreeBlocks{};
+        std::vector<std::pair<void*, size_t>> m_Regions;
+        size_t m_RegionSize{DefaultRegionSize};
+        size_t m_ReservedBytes{};
+        size_t m_UsedBytes{};
+        size_t m_HighWaterMark{};
+        size_t m_AllocationCount{};
+    };
+}// namespace Engine
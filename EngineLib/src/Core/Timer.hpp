@@ -1,5 +1,8 @@
-#include <chrono>
+#pragma once
+
+#include <string>
 #include <string_view>
+#include "Clock.hpp"
 #include "Log.hpp"
 
 class Timer
@@ -7,26 +10,16 @@ class Timer
 public:
     Timer() { Reset(); }
 
-    void Reset() { m_Start = std::chrono::high_resolution_clock::now(); }
+    void Reset() { m_Start = Engine::Clock::Now(); }
 
-    float Elapsed() const
-    {
-        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() -
-                                                                     m_Start)
-                       .count() *
-               0.001f * 0.001f;
-    }
+    uint64_t ElapsedTicks() const { return Engine::Clock::Now() - m_Start; }
 
-    float ElapsedMillis() const
-    {
-        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() -
-                                                                     m_Start)
-                       .count() *
-               0.001f;
-    }
+    double Elapsed() const { return Engine::Clock::ToSeconds(ElapsedTicks()); }
+
+    double ElapsedMillis() const { return Engine::Clock::ToMillis(ElapsedTicks()); }
 
 private:
-    std::chrono::time_point<std::chrono::high_resolution_clock> m_Start;
+    uint64_t m_Start{};
 };
 
 class ScopedTimer
@@ -36,7 +29,7 @@ public:
 
     ~ScopedTimer()
     {
-        float time = m_Timer.ElapsedMillis();
+        double time = m_Timer.ElapsedMillis();
         LOG_INFO("Timer: %s - %fms\n", m_Name.c_str(), time);
     }
 
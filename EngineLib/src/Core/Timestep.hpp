@@ -14,30 +14,33 @@
 
 namespace Engine
 {
+    /**
+     * Duration in seconds. Double precision, a float loses sub-millisecond steps once it holds a few hours.
+     */
     class Timestep
     {
     public:
         Timestep() = default;
 
-        Timestep(float time) : m_Time(time) {}
+        Timestep(double time) : m_Time(time) {}
 
     public:
-        float ToMillis() const { return m_Time * (float) 1000; }
+        double ToMillis() const { return m_Time * 1000.0; }
 
-        float ToMicros() const { return m_Time * (float) 1000000; }
+        double ToMicros() const { return m_Time * 1000000.0; }
 
-        float Time() const { return m_Time; }
+        double Time() const { return m_Time; }
 
-        void SetTime(float time) { m_Time = time; }
+        void SetTime(double time) { m_Time = time; }
 
     public:
         Timestep operator-(Timestep& other) { return Timestep(this->Time() - other.Time()); }
 
         Timestep operator+(Timestep& other) { return Timestep(this->Time() + other.Time()); }
 
-        operator float() const { return m_Time; }
+        operator double() const { return m_Time; }
 
     private:
-        float m_Time{};
+        double m_Time{};
     };
 }// namespace Engine
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * VirtualArena class implementation
+ */
+
+#include "VirtualArena.hpp"
+#include <Core/AllocationTracker.hpp>
+#include <Core/Log.hpp>
+
+#include <algorithm>
+
+namespace Engine
+{
+    namespace
+    {
+        size_t AlignUp(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+    }// namespace
+
+    VirtualArena::~VirtualArena() { Destroy(); }
+
+    bool VirtualArena::Init(const VirtualArenaSpec& spec)
+    {
+        Destroy();
+
+        // Commits have to cover whole huge pages to be backed by them.
+        auto pageSize = HugePageMode::None == spec.HugePages ? VirtualMemory::GetPageSize()
+                                                             : VirtualMemory::GetHugePageSize();
+        m_Spec = spec;
+        m_Spec.CommitGranularity = AlignUp(std::max(spec.CommitGranularity, pageSize), pageSize);
+        m_Reserved = AlignUp(spec.ReserveSize, m_Spec.CommitGranularity);
+
+        m_Base = static_cast<uint8_t*>(VirtualMemory::Reserve(m_Reserved, spec.HugePages));
+        if (nullptr == m_Base)
+        {
+            m_Reserved = 0;
+            return false;
+        }
+        return true;
+    }
+
+    void VirtualArena::Destroy()
+    {
+        if (nullptr == m_Base) { return; }
+
+        UpdateTracking(m_Committed, 0);
+        VirtualMemory::Release(m_Base, m_Reserved, m_Committed);
+
+        m_Base = nullptr;
+        m_Offset = 0;
+        m_Committed = 0;
+        m_Reserved = 0;
+    }
+
+    void* VirtualArena::Allocate(size_t size, size_t alignment)
+    {
+        if (nullptr == m_Base) { return nullptr; }
+
+        auto offset = AlignUp(m_Offset, alignment);
+        if (offset + size > m_Reserved)
+        {
+            LOG_ERROR("Virtual arena out of reserved space, %zuB requested with %zuB of %zuB used!\n", size, m_Offset,
+                      m_Reserved);
+            return nullptr;
+        }
+
+        if (offset + size > m_Committed && !CommitTo(offset + size)) { return nullptr; }
+
+        m_Offset = offset + size;
+        return m_Base + offset;
+    }
+
+    size_t VirtualArena::GetMarker() const { return m_Offset; }
+
+    void VirtualArena::Rewind(size_t marker) { m_Offset = std::min(marker, m_Offset); }
+
+    void VirtualArena::Reset() { m_Offset = 0; }
+
+    void VirtualArena::Trim(size_t keepBytes)
+    {
+        auto keep = AlignUp(std::max(m_Offset, keepBytes), m_Spec.CommitGranularity);
+        if (keep >= m_Committed) { return; }
+
+        VirtualMemory::Decommit(m_Base + keep, m_Committed - keep);
+        UpdateTracking(m_Committed, keep);
+        m_Committed = keep;
+    }
+
+    void* VirtualArena::GetBase() const { return m_Base; }
+
+    size_t VirtualArena::GetUsed() const { return m_Offset; }
+
+    size_t VirtualArena::GetCommitted() const { return m_Committed; }
+
+    size_t VirtualArena::GetReserved() const { return m_Reserved; }
+
+    bool VirtualArena::IsInitialized() const { return nullptr != m_Base; }
+
+    bool VirtualArena::CommitTo(size_t size)
+    {
+        auto target = std::min(AlignUp(size, m_Spec.CommitGranularity), m_Reserved);
+        if (!VirtualMemory::Commit(m_Base + m_Committed, target - m_Committed, m_Spec.HugePages)) { return false; }
+
+        UpdateTracking(m_Committed, target);
+        m_Committed = target;
+        return true;
+    }
+
+    void VirtualArena::UpdateTracking(size_t oldCommitted, size_t newCommitted)
+    {
+        // The committed range counts against the tag budget, it is not an allocation that could leak.
+        AllocationTracker::ResizeTagRange(m_Spec.Tag, oldCommitted, newCommitted);
+    }
+}// namespace Engine
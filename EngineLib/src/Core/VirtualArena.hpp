@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * VirtualArena class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <Core/MemoryTag.hpp>
+#include <Core/VirtualMemory.hpp>
+
+namespace Engine
+{
+    struct VirtualArenaSpec {
+        size_t ReserveSize = 1024ull * 1024 * 1024;
+        size_t CommitGranularity = 64 * 1024;
+        HugePageMode HugePages = HugePageMode::None;
+        MemoryTag Tag = MemoryTag::Core;
+    };
+
+    /**
+     * Bump allocator over one reserved address range that commits pages as it grows.
+     *
+     * The base address never moves, so pointers stay valid while the arena grows and the used part can be treated as
+     * one contiguous array. Committed memory counts against the spec tag's totals and budgets, but it is not an
+     * allocation record, so long lived arenas do not show up as leaks. Memory comes back through Rewind()/Reset(),
+     * Trim() hands committed pages beyond the used part back to the OS.
+     *
+     * Not thread safe.
+     */
+    class VirtualArena
+    {
+    public:
+        VirtualArena() = default;
+        ~VirtualArena();
+
+        VirtualArena(const VirtualArena&) = delete;
+        VirtualArena& operator=(const VirtualArena&) = delete;
+
+    public:
+        bool Init(const VirtualArenaSpec& spec = {});
+
+        void Destroy();
+
+        /** Returns nullptr once the reserved range is exhausted. */
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template <typename T>
+        T* AllocateArray(size_t count);
+
+        template <typename T, typename... Args>
+        T* Create(Args&&... args);
+
+        size_t GetMarker() const;
+
+        void Rewind(size_t marker);
+
+        void Reset();
+
+        /** Decommits pages past max(used, keepBytes). */
+        void Trim(size_t keepBytes = 0);
+
+    public:
+        void* GetBase() const;
+
+        size_t GetUsed() const;
+
+        size_t GetCommitted() const;
+
+        size_t GetReserved() const;
+
+        bool IsInitialized() const;
+
+    private:
+        bool CommitTo(size_t size);
+
+        void UpdateTracking(size_t oldCommitted, size_t newCommitted);
+
+    private:
+        uint8_t* m_Base{};
+        size_t m_Offset{};
+        size_t m_Committed{};
+        size_t m_Reserved{};
+        VirtualArenaSpec m_Spec{};
+    };
+}// namespace Engine
+
+#include "VirtualArena.impl.hpp"
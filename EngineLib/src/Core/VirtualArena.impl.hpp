@@ -0,0 +1,33 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * VirtualArena templated functions implementation
+ */
+
+#include <new>
+#include <utility>
+#include "VirtualArena.hpp"
+
+namespace Engine
+{
+    template <typename T>
+    T* VirtualArena::AllocateArray(size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    template <typename T, typename... Args>
+    T* VirtualArena::Create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destructed!");
+        auto memory = Allocate(sizeof(T), alignof(T));
+        return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+}// namespace Engine
@@ -0,0 +1,187 @@
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * VirtualMemory class implementation
+ */
+
+#ifdef _WIN32
+#include <Platform/WindowInstance.hpp>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "VirtualMemory.hpp"
+#include <Core/Log.hpp>
+
+#include <atomic>
+
+namespace Engine
+{
+    namespace
+    {
+        std::atomic<size_t> s_ReservedBytes{};
+        std::atomic<size_t> s_CommittedBytes{};
+        std::atomic<size_t> s_ReservationCount{};
+
+        constexpr size_t DefaultHugePageSize = 2 * 1024 * 1024;
+
+        void WarnHugePagesUnavailable(const char* reason)
+        {
+            LOG_ONCE(Memory, Warning, "Huge pages unavailable (%s), using normal pages\n", reason);
+        }
+    }// namespace
+
+    size_t VirtualMemory::GetPageSize()
+    {
+#ifdef _WIN32
+        static const size_t pageSize = [] {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<size_t>(info.dwPageSize);
+        }();
+#else
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        return pageSize;
+    }
+
+    size_t VirtualMemory::GetHugePageSize()
+    {
+#ifdef _WIN32
+        static const size_t hugePageSize = [] {
+            auto size = static_cast<size_t>(GetLargePageMinimum());
+            return 0 == size ? DefaultHugePageSize : size;
+        }();
+        return hugePageSize;
+#else
+        return DefaultHugePageSize;
+#endif
+    }
+
+    void* VirtualMemory::Reserve(size_t size, HugePageMode mode)
+    {
+        if (0 == size) { return nullptr; }
+
+#ifdef _WIN32
+        // Large pages can not be committed on demand on Windows, they have to be reserved and committed at once.
+        if (HugePageMode::None != mode) { WarnHugePagesUnavailable("no on demand commit for large pages"); }
+
+        auto address = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+        if (nullptr == address)
+        {
+            LOG_ERROR("Could not reserve %zuB of address space!\n", size);
+            return nullptr;
+        }
+#else
+        // Over reserve so the range can be trimmed to a huge page boundary.
+        auto alignment = HugePageMode::None == mode ? GetPageSize() : GetHugePageSize();
+        auto mappedSize = size + (HugePageMode::None == mode ? 0 : alignment);
+
+        auto mapped = mmap(nullptr, mappedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (MAP_FAILED == mapped)
+        {
+            LOG_ERROR("Could not reserve %zuB of address space!\n", size);
+            return nullptr;
+        }
+
+        auto begin = reinterpret_cast<uintptr_t>(mapped);
+        auto alignedBegin = (begin + alignment - 1) & ~(alignment - 1);
+        if (alignedBegin > begin) { munmap(mapped, alignedBegin - begin); }
+        auto tail = begin + mappedSize - (alignedBegin + size);
+        if (tail > 0) { munmap(reinterpret_cast<void*>(alignedBegin + size), tail); }
+
+        auto address = reinterpret_cast<void*>(alignedBegin);
+#endif
+
+        s_ReservedBytes.fetch_add(size, std::memory_order_relaxed);
+        s_ReservationCount.fetch_add(1, std::memory_order_relaxed);
+        return address;
+    }
+
+    bool VirtualMemory::Commit(void* address, size_t size, HugePageMode mode)
+    {
+        if (0 == size) { return true; }
+
+#ifdef _WIN32
+        (void) mode;
+        if (nullptr == VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE))
+        {
+            LOG_ERROR("Could not commit %zuB of memory!\n", size);
+            return false;
+        }
+#else
+        bool committed = false;
+        if (HugePageMode::Explicit == mode)
+        {
+            // Replaces the reserved pages in place, fails when the huge page pool is empty.
+            auto flags = MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS;
+            committed = MAP_FAILED != mmap(address, size, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+            if (!committed)
+            {
+                // A failed huge page mapping may already have dropped the reserved range, map it again.
+                WarnHugePagesUnavailable("huge page pool exhausted");
+                committed = MAP_FAILED != mmap(address, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+            }
+        }
+        else { committed = 0 == mprotect(address, size, PROT_READ | PROT_WRITE); }
+
+        if (!committed)
+        {
+            LOG_ERROR("Could not commit %zuB of memory!\n", size);
+            return false;
+        }
+
+        if (HugePageMode::Transparent == mode && 0 != madvise(address, size, MADV_HUGEPAGE))
+        {
+            WarnHugePagesUnavailable("transparent huge pages disabled");
+        }
+#endif
+
+        s_CommittedBytes.fetch_add(size, std::memory_order_relaxed);
+        return true;
+    }
+
+    void VirtualMemory::Decommit(void* address, size_t size)
+    {
+        if (0 == size) { return; }
+
+#ifdef _WIN32
+        VirtualFree(address, size, MEM_DECOMMIT);
+#else
+        // Mapping fresh reserved pages over the range drops the old ones, huge pages included.
+        mmap(address, size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+#endif
+
+        s_CommittedBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void VirtualMemory::Release(void* address, size_t size, size_t committedSize)
+    {
+        if (nullptr == address) { return; }
+
+#ifdef _WIN32
+        VirtualFree(address, 0, MEM_RELEASE);
+#else
+        munmap(address, size);
+#endif
+
+        s_CommittedBytes.fetch_sub(committedSize, std::memory_order_relaxed);
+        s_ReservedBytes.fetch_sub(size, std::memory_order_relaxed);
+        s_ReservationCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    VirtualMemoryStats VirtualMemory::GetStats()
+    {
+        VirtualMemoryStats stats;
+        stats.ReservedBytes = s_ReservedBytes.load(std::memory_order_relaxed);
+        stats.CommittedBytes = s_CommittedBytes.load(std::memory_order_relaxed);
+        stats.ReservationCount = s_ReservationCount.load(std::memory_order_relaxed);
+        return stats;
+    }
+}// namespace Engine
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * VirtualMemory class definition
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine
+{
+    enum class HugePageMode
+    {
+        None,
+        /** Ask the kernel to back the range with huge pages when it can (Linux THP). */
+        Transparent,
+        /** Map committed ranges from the explicit huge page pool, falls back to normal pages when it is empty. */
+        Explicit
+    };
+
+    struct VirtualMemoryStats {
+        size_t ReservedBytes{};
+        size_t CommittedBytes{};
+        size_t ReservationCount{};
+    };
+
+    /**
+     * Thin wrapper over the OS virtual memory calls, mmap/mprotect on Linux and VirtualAlloc/VirtualFree on Windows.
+     * Reserved ranges take address space only, pages are backed by memory once committed.
+     */
+    class VirtualMemory
+    {
+    public:
+        static size_t GetPageSize();
+
+        static size_t GetHugePageSize();
+
+        /** Returns nullptr on failure, the range is aligned to the huge page size when huge pages are requested. */
+        static void* Reserve(size_t size, HugePageMode mode = HugePageMode::None);
+
+        static bool Commit(void* address, size_t size, HugePageMode mode = HugePageMode::None);
+
+        static void Decommit(void* address, size_t size);
+
+        /** Gives back the whole range, committedSize is the part of it that was still committed. */
+        static void Release(void* address, size_t size, size_t committedSize = 0);
+
+        static VirtualMemoryStats GetStats();
+    };
+}// namespace Engine
@@ -6,6 +6,8 @@ namespace Engine
 
     std::string_view Layer::GetName() const { return p_Name; }
 
+    StringId Layer::GetId() const { return m_Id; }
+
     bool Layer::ShouldExit() { return m_ShouldExit; }
 
     void Layer::SetShouldExit(bool value) { m_ShouldExit = value; }
@@ -10,6 +10,8 @@
  */
 
 #include <string_view>
+#include <Core/StringId.hpp>
+#include <Layer/UpdateContext.hpp>
 
 namespace Engine
 {
@@ -23,18 +25,24 @@ namespace Engine
         virtual void OnAttach() = 0;
         virtual void OnDettach() = 0;
         virtual void OnDestroy() = 0;
-        virtual void OnUpdate() = 0;
+        virtual void OnUpdate(UpdateContext& context) = 0;
         virtual void OnMouseClickEvent() = 0;
         virtual void OnMouseMoveEvent() = 0;
         virtual void OnKeyboardEvent() = 0;
         virtual std::string_view GetName();
         virtual std::string_view GetName() const;
 
+        /** Interned name, assigned when the layer is added to the LayerStack. */
+        StringId GetId() const;
+
         bool ShouldExit();
         void SetShouldExit(bool value);
 
     private:
+        friend class LayerStack;
+
         bool m_ShouldExit;
+        StringId m_Id;
 
     protected:
         std::string_view p_Name;
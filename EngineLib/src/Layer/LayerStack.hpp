@@ -14,7 +14,7 @@
 
 #include <Layer/Layer.hpp>
 #include <Core/Result.hpp>
-#include <string_view>
+#include <Core/StringId.hpp>
 #include <vector>
 
 namespace Engine
@@ -51,10 +51,10 @@ namespace Engine
         static ResultValueType<LayerStackStatus> Init();
         template <typename T>
         static ResultValueType<LayerStatus> AddLayer();
-        static ResultValueType<LayerStatus> RemoveLayer(std::string_view name);
+        static ResultValueType<LayerStatus> RemoveLayer(StringId id);
         static ResultValueType<LayerStackStatus> Destroy();
         static ResultValue<LayerStackStatus, LayerStack*> Get();
-        static ResultValue<LayerStatus, Layer*> GetLayer(std::string_view name);
+        static ResultValue<LayerStatus, Layer*> GetLayer(StringId id);
         static ResultValue<LayerStatus, std::vector<Layer*>*> GetLayers();
         static ResultValueType<LayerStackStatus> InitLayers();
         static ResultValueType<LayerStackStatus> DestroyLayers();
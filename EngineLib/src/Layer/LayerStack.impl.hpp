@@ -12,7 +12,9 @@
 
 
 #include <Layer/LayerStack.hpp>
+#include <Core/Allocator.hpp>
 #include <Core/Log.hpp>
+#include <Core/Profiler.hpp>
 
 Engine::LayerStack* Engine::LayerStack::s_LayerStack = nullptr;
 
@@ -31,27 +33,29 @@ namespace Engine
     {
         if (!LayerStack::s_LayerStack) { return ResultValueType(LayerStatus::Error); }
 
-        LayerStack::s_LayerStack->m_Layers.emplace_back(new T());
-        LOG_INFO("Layer %s added!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
+        LayerStack::s_LayerStack->m_Layers.emplace_back(Allocator::AllocateTagged<T>(MemoryTag::Layer));
+        auto* layer = LayerStack::s_LayerStack->m_Layers.back();
+        layer->m_Id = StringId::Intern(layer->GetName());
+        LOG_CATEGORY(Layer, Info, "Layer %s added!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
 
         LayerStack::s_LayerStack->m_Layers.back()->OnAttach();
-        LOG_INFO("Layer %s attached!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
+        LOG_CATEGORY(Layer, Info, "Layer %s attached!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
 
         return {LayerStatus::Added};
     }
 
-    ResultValueType<LayerStatus> LayerStack::RemoveLayer(std::string_view name)
+    ResultValueType<LayerStatus> LayerStack::RemoveLayer(StringId id)
     {
         if (!LayerStack::s_LayerStack) { return ResultValueType(LayerStatus::Error); }
 
         uint32_t index = 0;
         for (auto& layer: LayerStack::s_LayerStack->m_Layers)
         {
-            if (layer->GetName() == std::string(name))
+            if (layer->GetId() == id)
             {
-                delete layer;
                 layer->OnDettach();
                 layer->OnDestroy();
+                Allocator::Deallocate(layer);
                 LayerStack::s_LayerStack->m_Layers.erase(LayerStack::s_LayerStack->m_Layers.begin() + index);
                 break;
             }
@@ -69,8 +73,8 @@ namespace Engine
 
         for (auto& layer: LayerStack::s_LayerStack->m_Layers)
         {
-            LOG_INFO("Layer %s removed!\n", layer->GetName().data());
-            delete layer;
+            LOG_CATEGORY(Layer, Info, "Layer %s removed!\n", layer->GetName().data());
+            Allocator::Deallocate(layer);
         }
         LayerStack::s_LayerStack->m_Layers.clear();
         delete LayerStack::s_LayerStack;
@@ -86,13 +90,13 @@ namespace Engine
         return ResultValue(LayerStackStatus::Success, s_LayerStack);
     }
 
-    ResultValue<LayerStatus, Layer*> LayerStack::GetLayer(std::string_view name)
+    ResultValue<LayerStatus, Layer*> LayerStack::GetLayer(StringId id)
     {
         if (!LayerStack::s_LayerStack) { return ResultValue(LayerStatus::Error, (Layer*) nullptr); }
 
         for (auto& layer: LayerStack::s_LayerStack->m_Layers)
         {
-            if (layer->GetName() == std::string(name)) { return ResultValue(LayerStatus::Success, layer); }
+            if (layer->GetId() == id) { return ResultValue(LayerStatus::Success, layer); }
         }
         return ResultValue(LayerStatus::Error, (Layer*) nullptr);
     }
@@ -111,8 +115,10 @@ namespace Engine
 
         for (auto& layer: LayerStack::s_LayerStack->m_Layers)
         {
+            PROFILE_SCOPE(layer->GetId().GetString());
             layer->Init();
-            LOG_INFO("Layer %s initialized!", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
+            LOG_CATEGORY(Layer, Info, "Layer %s initialized!",
+                         LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
         }
         return ResultValueType(LayerStackStatus::Initialized);
     }
@@ -123,10 +129,12 @@ namespace Engine
         for (auto& layer: LayerStack::s_LayerStack->m_Layers)
         {
             layer->Destroy();
-            LOG_INFO("Layer %s destroyed!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
+            LOG_CATEGORY(Layer, Info, "Layer %s destroyed!\n",
+                         LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
 
             layer->OnDettach();
-            LOG_INFO("Layer %s dettached!\n", LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
+            LOG_CATEGORY(Layer, Info, "Layer %s dettached!\n",
+                         LayerStack::s_LayerStack->m_Layers.back()->GetName().data());
         }
         return ResultValueType(LayerStackStatus::Destroyed);
     }
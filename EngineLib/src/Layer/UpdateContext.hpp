@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @file
+ * @brief 
+ * @version 1.0
+ * @date 
+ * 
+ * @section DESCRIPTION
+ * 
+ * UpdateContext structure definition
+ */
+
+#include <Core/FrameArena.hpp>
+#include <Core/Timestep.hpp>
+
+namespace Engine
+{
+    /**
+     * Per frame state handed to every Layer::OnUpdate call.
+     */
+    struct UpdateContext {
+        FrameArena& Arena;
+        uint64_t FrameNumber;
+        /** Clock ticks taken once at the start of the frame, every layer sees the same value. */
+        uint64_t FrameStart;
+        /** Since the start of the previous frame. */
+        Timestep DeltaTime;
+        /** Seconds since Application::Run started. */
+        double Time;
+    };
+}// namespace Engine
@@ -38,7 +38,13 @@ namespace Engine
         }
         LOG_INFO("Created Command Pool\n");
 
-        pCommandPool->CreateCommandBuffer();
+        auto commandBuffer = pCommandPool->CreateCommandBuffer();
+        if (!commandBuffer)
+        {
+            LOG_ERROR("Can Not Allocate Command Buffer!\n");
+            return std::unexpected(commandBuffer.error());
+        }
+        pCommandPool->m_PrimaryCommandBuffer = *commandBuffer;
         return CommandPoolState::Created;
     }
 
@@ -51,6 +57,8 @@ namespace Engine
                 vkFreeCommandBuffers(pCommandPool->m_VkDevice, pCommandPool->m_VkCommandPool, 1, &buffer);
                 bufferState = CommandBufferState::Invalid;
             }
+            pCommandPool->m_VkCommandBuffers.Clear();
+            pCommandPool->m_PrimaryCommandBuffer = {};
             pCommandPool->Destroy();
 
             LOG_INFO("Destroyed Command Pool\n");
@@ -63,7 +71,7 @@ namespace Engine
 
     void CommandPool::Destroy() { vkDestroyCommandPool(m_VkDevice, m_VkCommandPool, nullptr); }
 
-    auto CommandPool::CreateCommandBuffer() -> std::expected<CommandBufferState, ErrorStatus>
+    auto CommandPool::CreateCommandBuffer() -> std::expected<CommandBufferHandle, ErrorStatus>
     {
         VkCommandBufferAllocateInfo allocateInfo = {};
         allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -71,57 +79,65 @@ namespace Engine
         allocateInfo.commandPool = m_VkCommandPool;
         allocateInfo.commandBufferCount = 1;
 
-        std::vector<VkCommandBuffer> buffers(1);
-        auto result = vkAllocateCommandBuffers(m_VkDevice, &allocateInfo, buffers.data());
+        VkCommandBuffer buffer{};
+        auto result = vkAllocateCommandBuffers(m_VkDevice, &allocateInfo, &buffer);
         if (VK_SUCCESS != result) { return std::unexpected(ErrorStatus::Fail); }
 
-        auto buffer = buffers.front();
-        m_VkCommandBuffers.emplace_back(ResultValue{CommandBufferState::Initial, buffer});
+        return m_VkCommandBuffers.Emplace(CommandBufferState::Initial, buffer);
+    }
+
+    auto CommandPool::FreeCommandBuffer(CommandBufferHandle handle) -> std::expected<CommandBufferState, ErrorStatus>
+    {
+        auto commandBuffer = m_VkCommandBuffers.Get(handle);
+        if (nullptr == commandBuffer) { return std::unexpected(ErrorStatus::Invalid); }
+
+        vkFreeCommandBuffers(m_VkDevice, m_VkCommandPool, 1, &commandBuffer->value);
+        m_VkCommandBuffers.Erase(handle);
+        if (m_PrimaryCommandBuffer == handle) { m_PrimaryCommandBuffer = {}; }
 
-        return CommandBufferState::Created;
+        return CommandBufferState::Destroyed;
     }
 
-    std::expected<VkCommandBuffer, ErrorStatus> CommandPool::GetCommandBuffer(uint32_t id)
+    std::expected<VkCommandBuffer, ErrorStatus> CommandPool::GetCommandBuffer(CommandBufferHandle handle)
     {
-        if (m_VkCommandBuffers.size() <= id) { return std::unexpected(ErrorStatus::Invalid); }
+        auto commandBuffer = m_VkCommandBuffers.Get(handle);
+        if (nullptr == commandBuffer) { return std::unexpected(ErrorStatus::Invalid); }
 
-        return m_VkCommandBuffers[id].value;
+        return commandBuffer->value;
     }
 
-    auto CommandPool::BeginCommandBuffer(uint32_t id) -> std::expected<CommandBufferState, ErrorStatus>
+    auto CommandPool::BeginCommandBuffer(CommandBufferHandle handle) -> std::expected<CommandBufferState, ErrorStatus>
     {
-        if (m_VkCommandBuffers.size() <= id) { return std::unexpected(ErrorStatus::Invalid); }
+        auto commandBuffer = m_VkCommandBuffers.Get(handle);
+        if (nullptr == commandBuffer) { return std::unexpected(ErrorStatus::Invalid); }
 
-        if (CommandBufferState::Initial != m_VkCommandBuffers[id].status)
-        {
-            return std::unexpected(ErrorStatus::Invalid);
-        }
+        if (CommandBufferState::Initial != commandBuffer->status) { return std::unexpected(ErrorStatus::Invalid); }
 
         VkCommandBufferBeginInfo beginInfo = {};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        auto bufferStatus = vkBeginCommandBuffer(m_VkCommandBuffers[id].value, &beginInfo);
+        auto bufferStatus = vkBeginCommandBuffer(commandBuffer->value, &beginInfo);
 
         if (VK_SUCCESS != bufferStatus) { return std::unexpected(ErrorStatus::Invalid); }
 
 
-        m_VkCommandBuffers[id].status = CommandBufferState::Recording;
+        commandBuffer->status = CommandBufferState::Recording;
         return CommandBufferState::Recording;
     }
 
-    auto CommandPool::EndCommandBuffer(uint32_t id) -> std::expected<CommandBufferState, ErrorStatus>
+    auto CommandPool::EndCommandBuffer(CommandBufferHandle handle) -> std::expected<CommandBufferState, ErrorStatus>
     {
-        if (m_VkCommandBuffers.size() <= id) { return std::unexpected(ErrorStatus::Invalid); }
-        if (CommandBufferState::Recording != m_VkCommandBuffers[id].status)
-        {
-            return std::unexpected(ErrorStatus::Invalid);
-        }
+        auto commandBuffer = m_VkCommandBuffers.Get(handle);
+        if (nullptr == commandBuffer) { return std::unexpected(ErrorStatus::Invalid); }
+        if (CommandBufferState::Recording != commandBuffer->status) { return std::unexpected(ErrorStatus::Invalid); }
 
-        auto bufferStatus = vkEndCommandBuffer(m_VkCommandBuffers[id].value);
+        auto bufferStatus = vkEndCommandBuffer(commandBuffer->value);
         if (VK_SUCCESS != bufferStatus) { return std::unexpected(ErrorStatus::Invalid); }
 
-        m_VkCommandBuffers[id].status = CommandBufferState::Executable;
+        commandBuffer->status = CommandBufferState::Executable;
         return CommandBufferState::Executable;
     }
 
+    CommandBufferHandle CommandPool::GetPrimaryCommandBuffer() const { return m_PrimaryCommandBuffer; }
+
 }// namespace Engine
\ No newline at end of file
@@ -13,11 +13,11 @@
  */
 
 #include <expected>
-#include <vector>
 
 #include <vulkan/vulkan.h>
 
 #include <Core/Core.hpp>
+#include <Core/SlotMap.hpp>
 
 namespace Engine
 {
@@ -37,6 +37,9 @@ namespace Engine
         Pending,
         Invalid
     };
+
+    using CommandBufferEntry = ResultValue<CommandBufferState, VkCommandBuffer>;
+    using CommandBufferHandle = Handle<CommandBufferEntry>;
 }// namespace Engine
 
 namespace Engine
@@ -49,11 +52,15 @@ namespace Engine
         ~CommandPool() = default;
 
     public:
-        std::expected<CommandBufferState, ErrorStatus> CreateCommandBuffer();
-        std::expected<VkCommandBuffer, ErrorStatus> GetCommandBuffer(uint32_t id = 0);
+        std::expected<CommandBufferHandle, ErrorStatus> CreateCommandBuffer();
+        std::expected<CommandBufferState, ErrorStatus> FreeCommandBuffer(CommandBufferHandle handle);
+        std::expected<VkCommandBuffer, ErrorStatus> GetCommandBuffer(CommandBufferHandle handle);
+
+        std::expected<CommandBufferState, ErrorStatus> BeginCommandBuffer(CommandBufferHandle handle);
+        std::expected<CommandBufferState, ErrorStatus> EndCommandBuffer(CommandBufferHandle handle);
 
-        std::expected<CommandBufferState, ErrorStatus> BeginCommandBuffer(uint32_t id = 0);
-        std::expected<CommandBufferState, ErrorStatus> EndCommandBuffer(uint32_t id = 0);
+        /** The buffer allocated when the pool is created. */
+        CommandBufferHandle GetPrimaryCommandBuffer() const;
 
     public:
         static std::expected<CommandPoolState, ErrorStatus> Create(VkDevice device, uint32_t graphicsQueueFamilyIndex,
@@ -69,7 +76,8 @@ namespace Engine
 
     private:
         VkCommandPool m_VkCommandPool;
-        std::vector<ResultValue<CommandBufferState, VkCommandBuffer>> m_VkCommandBuffers;
+        SlotMap<CommandBufferEntry> m_VkCommandBuffers;
+        CommandBufferHandle m_PrimaryCommandBuffer;
         VkDevice m_VkDevice;
     };
 }// namespace Engine
\ No newline at end of file
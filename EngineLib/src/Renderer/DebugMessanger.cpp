@@ -16,6 +16,7 @@ Includes
 ***********************************************************************************************************************/
 #include "DebugMessanger.hpp"
 #include <Core/Log.hpp>
+#include <Core/ScratchStack.hpp>
 
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_to_string.hpp>
@@ -86,19 +87,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL debugMessageFunc(VkDebugUtilsMessageSeverityFlagB
     switch (messageSeverity)
     {
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
-            LOG_INFO(&message.str()[0]);
+            LOG_CATEGORY(Renderer, Info, "%s", message.str().c_str());
             break;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
-            LOG_INFO(&message.str()[0]);
+            LOG_CATEGORY(Renderer, Info, "%s", message.str().c_str());
             break;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
-            LOG_WARNING(&message.str()[0]);
+            LOG_CATEGORY(Renderer, Warning, "%s", message.str().c_str());
             break;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
-            LOG_ERROR(&message.str()[0]);
+            LOG_CATEGORY(Renderer, Error, "%s", message.str().c_str());
             break;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_FLAG_BITS_MAX_ENUM_EXT:
-            LOG_ERROR(&message.str()[0]);
+            LOG_CATEGORY(Renderer, Error, "%s", message.str().c_str());
             break;
     }
 
@@ -136,7 +137,8 @@ namespace Engine
     {
         uint32_t propertyCount{};
         vkEnumerateInstanceExtensionProperties(nullptr, &propertyCount, nullptr);
-        std::vector<VkExtensionProperties> props(propertyCount);
+        ScratchScope scratch;
+        auto props = scratch.AllocateArray<VkExtensionProperties>(propertyCount);
         vkEnumerateInstanceExtensionProperties(nullptr, &propertyCount, props.data());
 
         auto propertyIterator = std::find_if(props.begin(), props.end(), [](VkExtensionProperties const& ep) {
@@ -144,8 +146,7 @@ namespace Engine
         });
         if (propertyIterator == props.end())
         {
-            LOG_ERROR("Something went very wrong, cannot find " + std::string(VK_EXT_DEBUG_UTILS_EXTENSION_NAME) +
-                      " extension\n");
+            LOG_ERROR("Something went very wrong, cannot find %s extension\n", VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
             return false;
         }
 
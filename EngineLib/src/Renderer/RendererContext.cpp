@@ -11,6 +11,7 @@
 #include "RendererContext.hpp"
 #include "VulkanContext.hpp"
 #include <Core/Log.hpp>
+#include <Core/Profiler.hpp>
 #include <GLFW/glfw3.h>
 
 Engine::RendererContext* Engine::RendererContext::s_RendererContext = nullptr;
@@ -25,6 +26,7 @@ namespace Engine
 
     ResultValueType<RendererContextStatus> RendererContext::Init(RendererSpec& rendererSpec)
     {
+        PROFILE_FUNCTION();
         glfwInit();
         LOG_INFO("Creating RendererContext!\n");
         auto result = Window::Create(rendererSpec);
@@ -13,6 +13,7 @@
 #include "Renderer.hpp"
 #include "RendererContext.hpp"
 #include <Core/Log.hpp>
+#include <Core/Profiler.hpp>
 
 template <typename RendererContextType>
 Engine::Renderer<RendererContextType>* Engine::Renderer<RendererContextType>::s_Renderer = nullptr;
@@ -34,6 +35,7 @@ namespace Engine
     template <typename RendererContextType>
     ResultValueType<RendererStatus> Renderer<RendererContextType>::Init(RendererSpec& rendererSpec)
     {
+        PROFILE_FUNCTION();
         auto result = RendererContextType::Create(rendererSpec);
 
         uint32_t tries = 0, maxTries = 3;
@@ -27,7 +27,7 @@ namespace Engine
 
             if (module.GetCompilationStatus() != shaderc_compilation_status_success)
             {
-                LOG_ERROR(module.GetErrorMessage());
+                LOG_ERROR("%s", module.GetErrorMessage().c_str());
                 return std::unexpected(ErrorStatus::CanNotCompileShader);
             }
             m_ShaderBinary[kind] = std::vector<uint32_t>(module.begin(), module.end());
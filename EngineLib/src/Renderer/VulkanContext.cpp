@@ -21,12 +21,15 @@ Includes
 
 #include <Core/EngineInfo.hpp>
 #include <Core/Log.hpp>
+#include <Core/Profiler.hpp>
+#include <Core/ScratchStack.hpp>
 #include <Renderer/Shader.hpp>
 
 #include <shaderc/shaderc.hpp>
 
 
 #include <algorithm>
+#include <cstring>
 #include <ranges>
 
 Engine::VulkanContext* Engine::VulkanContext::s_VulkanContext = {};
@@ -36,6 +39,7 @@ namespace Engine
 
     ResultValueType<VulkanContextStatus> VulkanContext::Create(VulkanSpec spec, Window* windowPtr)
     {
+        PROFILE_FUNCTION();
         VulkanContext::s_VulkanContext = new VulkanContext(spec, windowPtr);
         auto vulkanContextPtr = VulkanContext::Get();
 
@@ -82,8 +86,8 @@ namespace Engine
 
         const std::string source_name = "shader_src";
         shaderc_shader_kind kind = shaderc_glsl_vertex_shader;
-        const std::string source = "#version 460 core\n"
-                                   "void main() { }\n";
+        constexpr std::string_view source = "#version 460 core\n"
+                                            "void main() { }\n";
         shader.CreateFromString(source, source);
         shader.Compile();
 
@@ -154,6 +158,7 @@ namespace Engine
 
     ResultValueType<VulkanInstanceStatus> VulkanContext::CreateInstance()
     {
+        PROFILE_FUNCTION();
         LOG_INFO("Creating Vulkan Instance\n");
         LOG_INFO("    Application Name: %s\n", m_Spec.rendererSpec.AppName.data());
         LOG_INFO("    Engine Name: %s\n", ENGINE_INFO.Name.c_str());
@@ -172,25 +177,27 @@ namespace Engine
 
         bool availableDebugFlag = DebugMessanger::IsDebugExtensionAvailable();
 
-        std::vector<const char*> extensions;
+        ScratchScope scratch;
+        auto extensions = scratch.AllocateArray<const char*>(m_Spec.extensions.size() + 1);
+        uint32_t extensionCount{};
 
         LOG_INFO("Enabled Instance Extensions:\n");
         for (auto& extension: m_Spec.extensions)
         {
-            extensions.push_back(extension.c_str());
+            extensions[extensionCount++] = extension.c_str();
             LOG_INFO("    %s\n", extension.c_str());
         }
 
         if (availableDebugFlag)
         {
-            extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+            extensions[extensionCount++] = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
             LOG_INFO("    %s\n", VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
         }
 
         VkInstanceCreateInfo instanceCreateInfo = {};
         instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
         instanceCreateInfo.pApplicationInfo = &applicationInfo;
-        instanceCreateInfo.enabledExtensionCount = extensions.size();
+        instanceCreateInfo.enabledExtensionCount = extensionCount;
         instanceCreateInfo.ppEnabledExtensionNames = extensions.data();
 
         auto instanceResult = vkCreateInstance(&instanceCreateInfo, nullptr, &VulkanContext::Get()->m_Instance);
@@ -204,10 +211,12 @@ namespace Engine
 
     ResultValueType<VulkanPhysicalDeviceStatus> VulkanContext::SelectPhysicalDevice()
     {
+        PROFILE_FUNCTION();
         LOG_INFO("Found Devices:\n");
         uint32_t deviceCount{};
         vkEnumeratePhysicalDevices(VulkanContext::Get()->m_Instance, &deviceCount, nullptr);
-        std::vector<VkPhysicalDevice> enumeratedDevices(deviceCount);
+        ScratchScope scratch;
+        auto enumeratedDevices = scratch.AllocateArray<VkPhysicalDevice>(deviceCount);
         vkEnumeratePhysicalDevices(VulkanContext::Get()->m_Instance, &deviceCount, enumeratedDevices.data());
 
         for (auto device: enumeratedDevices)
@@ -241,7 +250,6 @@ namespace Engine
 
         VkPhysicalDeviceProperties deviceProps{};
         vkGetPhysicalDeviceProperties(m_PhysicalDevice, &deviceProps);
-        std::string selectedDevice = std::string(deviceProps.deviceName);
         LOG_INFO("Selected: %s\n", deviceProps.deviceName);
 
         return {VulkanPhysicalDeviceStatus::Selected};
@@ -249,9 +257,11 @@ namespace Engine
 
     ResultValueType<VulkanQueueFamilyStatus> VulkanContext::SelectQueueFamily()
     {
+        PROFILE_FUNCTION();
         uint32_t queueFamilyCount = 0;
         vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &queueFamilyCount, nullptr);
-        std::vector<VkQueueFamilyProperties> queueFamilyProperties(queueFamilyCount);
+        ScratchScope scratch;
+        auto queueFamilyProperties = scratch.AllocateArray<VkQueueFamilyProperties>(queueFamilyCount);
         vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &queueFamilyCount, queueFamilyProperties.data());
 
         //Find Graphics Queue Index
@@ -316,27 +326,29 @@ namespace Engine
 
     ResultValueType<VulkanSwapchainStatus> VulkanContext::GetCapabilities()
     {
+        PROFILE_FUNCTION();
         LOG_INFO("Retrieving Capabilities...\n");
         uint32_t surfaceFormatCount = 0;
         auto surfaceFormatStatus =
                 vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, m_Surface, &surfaceFormatCount, nullptr);
-        m_SupportedFormats.resize(surfaceFormatCount);
+        ScratchScope scratch;
+        auto supportedFormats = scratch.AllocateArray<VkSurfaceFormatKHR>(surfaceFormatCount);
         surfaceFormatStatus = vkGetPhysicalDeviceSurfaceFormatsKHR(m_PhysicalDevice, m_Surface, &surfaceFormatCount,
-                                                                   m_SupportedFormats.data());
+                                                                   supportedFormats.data());
         if (VK_SUCCESS != surfaceFormatStatus)
         {
             LOG_ERROR("Can Not Retrieve Surface Formats!\n");
             return {VulkanSwapchainStatus::Fail};
         }
 
-        if (m_SupportedFormats.empty())
+        if (supportedFormats.empty())
         {
             LOG_ERROR("Surface Formats Not Available!\n");
             return {VulkanSwapchainStatus::Fail};
         }
 
-        m_Format = m_SupportedFormats[0].format;
-        if (VK_FORMAT_UNDEFINED == m_SupportedFormats[0].format) { m_Format = VK_FORMAT_B8G8R8A8_UNORM; }
+        m_Format = supportedFormats[0].format;
+        if (VK_FORMAT_UNDEFINED == supportedFormats[0].format) { m_Format = VK_FORMAT_B8G8R8A8_UNORM; }
 
         auto surfaceCapabilitiesStatus =
                 vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_PhysicalDevice, m_Surface, &m_SurfaceCapabilities);
@@ -361,6 +373,7 @@ namespace Engine
 
     ResultValueType<VulkanSwapchainStatus> VulkanContext::CreateSwapchain()
     {
+        PROFILE_FUNCTION();
 
         auto queueFamilyStatus = SelectQueueFamily();
         if (VulkanQueueFamilyStatus::Found != queueFamilyStatus)
@@ -468,6 +481,7 @@ namespace Engine
 
     ResultValueType<VulkanDeviceStatus> VulkanContext::CreateDevice()
     {
+        PROFILE_FUNCTION();
         uint32_t availableExtensionCount = 0;
         auto result =
                 vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &availableExtensionCount, nullptr);
@@ -476,7 +490,8 @@ namespace Engine
             LOG_ERROR("Can Not Retrieve Available Device Extensions!\n");
             return {VulkanDeviceStatus::Fail};
         }
-        std::vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+        ScratchScope scratch;
+        auto availableExtensions = scratch.AllocateArray<VkExtensionProperties>(availableExtensionCount);
         result = vkEnumerateDeviceExtensionProperties(m_PhysicalDevice, nullptr, &availableExtensionCount,
                                                       availableExtensions.data());
         if (VK_SUCCESS != result)
@@ -486,7 +501,7 @@ namespace Engine
         }
         auto propertyIterator = std::find_if(
                 availableExtensions.begin(), availableExtensions.end(), [](VkExtensionProperties const& properties) {
-                    return std::string(properties.extensionName) == std::string("VK_KHR_swapchain");
+                    return 0 == strcmp(properties.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME);
                 });
         if (availableExtensions.end() == propertyIterator)
         {
@@ -500,13 +515,13 @@ namespace Engine
         deviceQueueCreateInfo.queueCount = 1;
         deviceQueueCreateInfo.pQueuePriorities = &queuePriority;
 
-        const std::vector<const char*> deviceExtensions = {"VK_KHR_swapchain"};
+        const char* deviceExtensions[] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
         VkDeviceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         createInfo.queueCreateInfoCount = 1;
         createInfo.pQueueCreateInfos = &deviceQueueCreateInfo;
         createInfo.enabledExtensionCount = 1;
-        createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+        createInfo.ppEnabledExtensionNames = deviceExtensions;
 
         auto deviceStatus = vkCreateDevice(m_PhysicalDevice, &createInfo, nullptr, &m_Device);
 
@@ -89,7 +89,6 @@ namespace Engine
         CommandPool* m_CommandPool{};
         uint32_t m_GraphicsQueueIndex{};
         uint32_t m_PresentQueueIndex{};
-        std::vector<VkSurfaceFormatKHR> m_SupportedFormats;
         VkSurfaceCapabilitiesKHR m_SurfaceCapabilities;
         VkFormat m_Format;
         VkExtent2D m_SwapchainExtent;
@@ -17,7 +17,7 @@ namespace Engine
 {
 
 
-    Window::~Window() { LOG_INFO("Destroyed Window\n"); }
+    Window::~Window() { LOG_CATEGORY(Window, Info, "Destroyed Window\n"); }
 
     void Window::PollEvents() 
     { 
@@ -39,7 +39,7 @@ enum class WindowStatus
 
 namespace Engine
 {
-    class Window : public RefCounted
+    class Window : public LocalRefCounted
     {
     public:
         virtual ~Window();
@@ -0,0 +1,130 @@
+/**
+ * @file
+ * @brief
+ * @version 1.0
+ * @date
+ *
+ * @section DESCRIPTION
+ *
+ * Expands binary logs written with LoggerSpec::BinaryFilePath into text
+ */
+
+#include <Core/BinaryReader.hpp>
+#include <Core/Log.hpp>
+#include <Core/LogFormat.hpp>
+#include <Core/MappedBuffer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void PrintUsage() { fprintf(stderr, "Usage: LogDecoder [--relative] <binary log> [output]\n"); }
+
+    void AppendTimestamp(std::string& output, int64_t nanoseconds)
+    {
+        char text[32];
+        snprintf(text, sizeof(text), "%12.6f ", static_cast<double>(nanoseconds) / 1e9);
+        output += text;
+    }
+}// namespace
+
+int main(int argc, char** argv)
+{
+    bool relative = false;
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--relative")) { relative = true; }
+        else if (!inputPath) { inputPath = argv[i]; }
+        else if (!outputPath) { outputPath = argv[i]; }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (!inputPath)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    Engine::MappedBuffer file;
+    if (!file.Open(inputPath, Engine::MappedAccessHint::Sequential))
+    {
+        fprintf(stderr, "Can not open %s\n", inputPath);
+        return 1;
+    }
+
+    FILE* output = stdout;
+    if (outputPath && !(output = fopen(outputPath, "w")))
+    {
+        fprintf(stderr, "Can not open %s\n", outputPath);
+        return 1;
+    }
+
+    Engine::BinaryReader reader(file.GetView());
+    auto header = reader.ReadHeader(Engine::LogFileFormat::Magic, 1, Engine::LogFileFormat::Version);
+    if (!header) { return 1; }
+    const bool hasCategories = header->Version >= 2;
+
+    // Site ids restart with every run appended to the file, a redefinition replaces the old format.
+    std::vector<std::string> sites;
+    std::string text;
+    int64_t firstTimestamp = -1;
+    uint64_t messageCount = 0;
+    while (reader.IsValid() && reader.GetRemaining() > 0)
+    {
+        auto entry = reader.Read<Engine::LogFileFormat::Entry>();
+        if (Engine::LogFileFormat::Entry::Site == entry)
+        {
+            auto offset = reader.GetOffset() - 1;
+            auto id = reader.Read<uint32_t>();
+            auto format = reader.ReadBytes(reader.Read<uint32_t>());
+            if (!reader.IsValid()) { break; }
+            // Ids are handed out in order, anything past the next one is corruption, not a reason to grow the table.
+            if (id > sites.size())
+            {
+                fprintf(stderr, "Corrupt site id %u at offset %u\n", id, offset);
+                break;
+            }
+            if (id == sites.size()) { sites.emplace_back(); }
+            sites[id].assign(reinterpret_cast<const char*>(format.Data()), format.GetSize());
+            continue;
+        }
+        if (Engine::LogFileFormat::Entry::Message != entry && Engine::LogFileFormat::Entry::Text != entry)
+        {
+            fprintf(stderr, "Unknown entry %u at offset %u\n", static_cast<uint32_t>(entry), reader.GetOffset() - 1);
+            break;
+        }
+
+        auto level = reader.Read<Engine::LogLevel>();
+        auto category = hasCategories ? reader.Read<Engine::LogCategory>() : Engine::LogCategory::General;
+        auto timestamp = reader.Read<int64_t>();
+        uint32_t site = Engine::LogFileFormat::Entry::Message == entry ? reader.Read<uint32_t>() : 0;
+        auto bytes = reader.ReadBytes(reader.Read<uint32_t>());
+        if (!reader.IsValid()) { break; }
+
+        text.clear();
+        if (firstTimestamp < 0) { firstTimestamp = timestamp; }
+        AppendTimestamp(text, relative ? timestamp - firstTimestamp : timestamp);
+        Engine::Logger::AppendPrefix(text, category, level);
+        if (Engine::LogFileFormat::Entry::Text == entry)
+        {
+            text.append(reinterpret_cast<const char*>(bytes.Data()), bytes.GetSize());
+        }
+        else if (site < sites.size()) { Engine::LogFormat::Format(text, sites[site].c_str(), bytes); }
+        else { text += "<unknown site>\n"; }
+        fwrite(text.data(), 1, text.size(), output);
+        messageCount++;
+    }
+
+    if (!reader.IsValid()) { fprintf(stderr, "Log ends with a truncated entry at offset %u\n", reader.GetOffset()); }
+    fprintf(stderr, "%llu messages\n", static_cast<unsigned long long>(messageCount));
+    if (output != stdout) { fclose(output); }
+    return reader.IsValid() ? 0 : 2;
+}
@@ -23,7 +23,7 @@ public:
 
     void OnDestroy() override {}
 
-    void OnUpdate() override {}
+    void OnUpdate(Engine::UpdateContext& context) override {}
 
     void OnMouseClickEvent() override {}
 
@@ -9,7 +9,7 @@ add_compile_options(
 set(target_list "" CACHE INTERNAL "target_list")
 list(APPEND target_list_kind_to_skip "INTERFACE" "ALIAS")
 list(APPEND target_kinds "INTERFACE" "ALIAS" "OBJECT" "STATIC" "SHARED" "MODULE")
-list(APPEND our_targets_to_skip "EngineLib" "Sandbox")
+list(APPEND our_targets_to_skip "EngineLib" "Sandbox" "LogDecoder")
 function(add_library name kind)
     message("Adding library ${name}")
     if("${name}" IN_LIST our_targets_to_skip)
@@ -30,6 +30,7 @@ endfunction()
 function(add_executable name)
     message("Adding executable ${name}")
     if("${name}" IN_LIST our_targets_to_skip)
+    elseif("${name}" MATCHES "Benchmark$")
     elseif("${name}" MATCHES "Python")
     else()
         set(target_list ${target_list} ${name} CACHE INTERNAL "target_list")